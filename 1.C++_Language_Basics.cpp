@@ -1,6 +1,19 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #define MAX_VALUE 100
 
@@ -26,6 +39,261 @@ constexpr int getCompileTimeValue() {
     return 2 * 2;
 }
 
+// Where and why parsing failed; message is null while there is no error.
+struct InputError {
+    size_t offset = 0;  // byte offset from the start of the input
+    size_t line = 0;    // 1-based
+    size_t column = 0;  // 1-based
+    const char* message = nullptr;
+    explicit operator bool() const { return message != nullptr; }
+};
+
+// Block-buffered scanner over a file descriptor (stdin by default) or a file.
+// It reads 64 KB at a time with read(2) and parses tokens in place: numbers
+// with std::from_chars, token and line ends with a 16-byte SIMD delimiter scan.
+// A failed read() returns false and records an InputError with the position;
+// the offending token is skipped so the caller can simply carry on.
+class InputScanner {
+public:
+    explicit InputScanner(int fd = STDIN_FILENO, size_t blockSize = 1 << 16)
+        : _fd(fd), _blockSize(blockSize), _buffer(blockSize) {}
+
+    explicit InputScanner(const char* path, size_t blockSize = 1 << 16)
+        : _fd(::open(path, O_RDONLY)), _ownsFd(true), _blockSize(blockSize), _buffer(blockSize) {}
+
+    InputScanner(const InputScanner&) = delete;
+    InputScanner& operator=(const InputScanner&) = delete;
+
+    ~InputScanner() {
+        if (_ownsFd && _fd >= 0) {
+            ::close(_fd);
+        }
+    }
+
+    bool is_open() const { return _fd >= 0; }
+    const InputError& error() const { return _error; }
+
+    // Next whitespace-separated token; the view is valid until the next call.
+    bool readToken(std::string_view& token) {
+        _error = InputError{};
+        if (!skipWhitespace()) {
+            return false;
+        }
+        size_t end = scanUntil(_pos, false);
+        token = std::string_view(_buffer.data() + _pos, end - _pos);
+        _pos = end;
+        return true;
+    }
+
+    // Next line without its '\n' (or '\r\n'); the view is valid until the next call.
+    bool readLine(std::string_view& line) {
+        _error = InputError{};
+        if (_pos == _end && !refill()) {
+            return false;
+        }
+        size_t end = scanUntil(_pos, true);
+        size_t length = end - _pos;
+        if (length > 0 && _buffer[_pos + length - 1] == '\r') {
+            --length;
+        }
+        line = std::string_view(_buffer.data() + _pos, length);
+        _pos = end < _end ? end + 1 : end;
+        return true;
+    }
+
+    // Integers and floating-point numbers. A leading '+' is accepted, as with
+    // operator>>; anything else that is not part of the number is an error.
+    template <typename T>
+    bool read(T& value) {
+        std::string_view token;
+        if (!readToken(token)) {
+            return false;
+        }
+        const size_t tokenOffset = _consumed + static_cast<size_t>(token.data() - _buffer.data());
+        const char* first = token.data();
+        const char* last = token.data() + token.size();
+        if (first + 1 < last && *first == '+' && first[1] != '-') {
+            ++first;
+        }
+        auto [ptr, ec] = std::from_chars(first, last, value);
+        if (ec == std::errc::result_out_of_range) {
+            return fail(tokenOffset, "number out of range");
+        }
+        if (ec != std::errc() || ptr != last) {
+            return fail(tokenOffset, ec != std::errc() ? "not a number" : "unexpected characters after number");
+        }
+        return true;
+    }
+
+private:
+    // First delimiter at or after from: '\n' for lines, any of " \t\r\n" for
+    // tokens. Refills (keeping the partial token) when it runs off the buffer.
+    size_t scanUntil(size_t from, bool lineOnly) {
+        for (;;) {
+            size_t found = findDelimiter(from, lineOnly);
+            if (found < _end || _eof) {
+                return found;
+            }
+            size_t scanned = found - _pos;
+            if (!refill()) {
+                return _end;
+            }
+            from = _pos + scanned;
+        }
+    }
+
+    size_t findDelimiter(size_t from, bool lineOnly) const {
+        const char* data = _buffer.data();
+        size_t i = from;
+#if defined(__SSE2__)
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i carriage = _mm_set1_epi8('\r');
+        for (; i + 16 <= _end; i += 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i hits = _mm_cmpeq_epi8(block, newline);
+            if (!lineOnly) {
+                hits = _mm_or_si128(hits, _mm_or_si128(_mm_cmpeq_epi8(block, space),
+                                                       _mm_or_si128(_mm_cmpeq_epi8(block, tab), _mm_cmpeq_epi8(block, carriage))));
+            }
+            int mask = _mm_movemask_epi8(hits);
+            if (mask != 0) {
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+            }
+        }
+#endif
+        for (; i < _end; ++i) {
+            char c = data[i];
+            if (c == '\n' || (!lineOnly && (c == ' ' || c == '\t' || c == '\r'))) {
+                return i;
+            }
+        }
+        return _end;
+    }
+
+    bool skipWhitespace() {
+        for (;;) {
+            while (_pos < _end && (_buffer[_pos] == ' ' || _buffer[_pos] == '\n' || _buffer[_pos] == '\t' || _buffer[_pos] == '\r')) {
+                ++_pos;
+            }
+            if (_pos < _end) {
+                return true;
+            }
+            if (!refill()) {
+                return false;
+            }
+        }
+    }
+
+    // Drops consumed bytes (keeping [_pos, _end)), growing the buffer if a
+    // single token fills it, then reads another block. False at end of input.
+    bool refill() {
+        if (_eof || _fd < 0) {
+            return false;
+        }
+        forget(_pos);
+        std::memmove(_buffer.data(), _buffer.data() + _pos, _end - _pos);
+        _end -= _pos;
+        _pos = 0;
+        if (_buffer.size() - _end < _blockSize) {
+            _buffer.resize(_end + _blockSize);
+        }
+        ssize_t n;
+        do {
+            n = ::read(_fd, _buffer.data() + _end, _buffer.size() - _end);
+        } while (n < 0 && errno == EINTR);
+        if (n <= 0) {
+            _eof = true;
+            return _pos < _end;
+        }
+        _end += static_cast<size_t>(n);
+        return true;
+    }
+
+    // Keeps line bookkeeping for the first count buffered bytes before they are discarded.
+    void forget(size_t count) {
+        const char* data = _buffer.data();
+        for (const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', data + count - p))) != nullptr; ++p) {
+            ++_lines;
+            _lineStart = _consumed + static_cast<size_t>(p - data) + 1;
+        }
+        _consumed += count;
+    }
+
+    bool fail(size_t offset, const char* message) {
+        size_t line = _lines + 1, lineStart = _lineStart;
+        const char* data = _buffer.data();
+        for (size_t i = 0; _consumed + i < offset; ++i) {
+            if (data[i] == '\n') {
+                ++line;
+                lineStart = _consumed + i + 1;
+            }
+        }
+        _error = InputError{offset, line, offset - lineStart + 1, message};
+        return false;
+    }
+
+    int _fd;
+    bool _ownsFd = false;
+    bool _eof = false;
+    size_t _blockSize;
+    std::vector<char> _buffer;
+    size_t _pos = 0, _end = 0;
+    size_t _consumed = 0;   // input bytes discarded before _buffer[0]
+    size_t _lines = 0;      // newlines among them
+    size_t _lineStart = 0;  // offset where the current line began
+    InputError _error;
+};
+
+// Parses a generated file of ints and doubles with operator>> and with InputScanner.
+void bulkInputBenchmark() {
+    const char* path = "bulk_input.txt";
+    const int count = 2000000;
+    {
+        std::FILE* out = std::fopen(path, "w");
+        if (!out) {
+            std::cerr << "Error: could not create " << path << std::endl;
+            return;
+        }
+        for (int i = 0; i < count; ++i) {
+            std::fprintf(out, "%d %.6f\n", static_cast<int>(i * 7919LL % 2000003) - 1000000, i * 0.25);
+        }
+        std::fclose(out);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    long long intSum = 0;
+    double doubleSum = 0;
+    {
+        std::ifstream in(path);
+        int n;
+        double x;
+        while (in >> n >> x) {
+            intSum += n;
+            doubleSum += x;
+        }
+    }
+    std::chrono::duration<double, std::milli> streamMs = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "operator>>:   " << streamMs.count() << " ms (sums " << intSum << ", " << doubleSum << ")" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    intSum = 0;
+    doubleSum = 0;
+    {
+        InputScanner in(path);
+        int n;
+        double x;
+        while (in.read(n) && in.read(x)) {
+            intSum += n;
+            doubleSum += x;
+        }
+    }
+    std::chrono::duration<double, std::milli> scannerMs = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "InputScanner: " << scannerMs.count() << " ms (sums " << intSum << ", " << doubleSum << ")" << std::endl;
+    std::remove(path);
+}
+
 int main() {
     
     
@@ -66,23 +334,31 @@ int main() {
     
     
     std::cout << "--- Input/Output ---" << std::endl;
+    InputScanner input;
     std::string name;
-    std::cout << "Enter your name: ";
-    std::getline(std::cin, name);
+    std::string_view line;
+    std::cout << "Enter your name: " << std::flush;
+    if (input.readLine(line)) {
+        name = line;
+    }
     std::cout << "Hello, " << name << "!" << std::endl;
 
     int age;
-    std::cout << "Enter your age: ";
-    std::cin >> age;
-    if (std::cin.fail()) {
-        std::cerr << "Error: Invalid input for age." << std::endl;
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-    } else {
+    std::cout << "Enter your age: " << std::flush;
+    if (input.read(age)) {
         std::cout << "You are " << age << " years old." << std::endl;
+    } else if (const InputError& error = input.error()) {
+        std::cerr << "Error: Invalid input for age at line " << error.line << ", column " << error.column
+                  << ": " << error.message << std::endl;
+    } else {
+        std::cerr << "Error: No input for age." << std::endl;
     }
     std::cout << std::endl;
 
+    std::cout << "--- Bulk Input ---" << std::endl;
+    bulkInputBenchmark();
+    std::cout << std::endl;
+
     
     
     enum Flags {
@@ -2,6 +2,19 @@
 #include <stdexcept> 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 double divide(int numerator, int denominator) {
     if (denominator == 0) {
@@ -45,7 +58,426 @@ void processData(const std::vector<int>& data) {
     std::cout << "Data processed successfully." << std::endl;
 }
 
+// Asynchronous logger. A log call does no formatting and no I/O: it copies the
+// format-string pointer and the raw argument bytes into a ring buffer owned by
+// the calling thread (single producer, single consumer, no locks). A background
+// thread drains every ring, formats the records and writes them in one fwrite
+// per batch. The format string must outlive the logger (use literals); "{}"
+// marks each argument. Strings are copied, so e.what() and temporaries are safe.
+enum class LogLevel : uint8_t { Info, Warning, Error };
+enum class OverflowPolicy { Drop, Block };
+
+namespace logdetail {
+
+// String literals and char arrays decay to const char* and count as strings.
+template <typename T, typename D = std::decay_t<T>>
+constexpr bool isString = std::is_same_v<D, const char*> || std::is_same_v<D, char*> ||
+                          std::is_same_v<D, std::string> || std::is_same_v<D, std::string_view>;
+
+// What an argument is stored and decoded as.
+template <typename T>
+using Stored = std::conditional_t<isString<T>, std::string_view, std::decay_t<T>>;
+
+template <typename T>
+size_t encodedSize(const T& value) {
+    if constexpr (isString<T>) {
+        return sizeof(uint32_t) + std::string_view(value).size();
+    } else {
+        static_assert(std::is_arithmetic_v<T>, "log arguments must be numbers or strings");
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+void encode(char*& out, const T& value) {
+    if constexpr (isString<T>) {
+        std::string_view text(value);
+        uint32_t length = static_cast<uint32_t>(text.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), text.data(), text.size());
+        out += sizeof(length) + text.size();
+    } else {
+        std::memcpy(out, &value, sizeof(T));
+        out += sizeof(T);
+    }
+}
+
+template <typename T>
+T decode(const char*& in) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        uint32_t length;
+        std::memcpy(&length, in, sizeof(length));
+        std::string_view text(in + sizeof(length), length);
+        in += sizeof(length) + length;
+        return text;
+    } else {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+}
+
+template <typename T>
+void append(std::string& out, const T& value) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        out.append(value);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        out.append(value ? "true" : "false");
+    } else if constexpr (std::is_same_v<T, char>) {
+        out.push_back(value);
+    } else {
+        char digits[64];
+        out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+    }
+}
+
+// Appends fmt up to the next "{}" and returns the position after it (or the end).
+inline const char* appendLiteral(const char* fmt, std::string& out) {
+    const char* mark = std::strstr(fmt, "{}");
+    if (mark == nullptr) {
+        out.append(fmt);
+        return fmt + std::strlen(fmt);
+    }
+    out.append(fmt, mark);
+    return mark + 2;
+}
+
+template <typename... Args>
+void formatRecord(const char* fmt, const char* payload, std::string& out) {
+    ((fmt = appendLiteral(fmt, out), append(out, decode<Args>(payload))), ...);
+    (void)payload;
+    out.append(fmt);
+}
+
+using FormatFn = void (*)(const char*, const char*, std::string&);
+
+struct RecordHeader {
+    uint32_t size;     // whole record, header included, multiple of 8
+    LogLevel level;
+    FormatFn format;   // null marks padding up to the end of the ring
+    const char* fmt;
+    int64_t timestamp; // steady_clock nanoseconds
+};
+
+// Byte ring with one producer thread and the logger thread as consumer. head
+// and tail only grow; records never wrap, the tail end is padded instead.
+struct Ring {
+    explicit Ring(size_t capacity) : capacity(capacity), data(new uint64_t[capacity / 8]) {}
+
+    char* bytes() { return reinterpret_cast<char*>(data.get()); }
+
+    const size_t capacity;
+    std::unique_ptr<uint64_t[]> data;
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    std::atomic<bool> abandoned{false};  // producer thread has exited
+    std::atomic<bool> orphaned{false};   // logger has been destroyed
+};
+
+} // namespace logdetail
+
+class AsyncLogger {
+public:
+    explicit AsyncLogger(std::FILE* out = stderr, OverflowPolicy policy = OverflowPolicy::Drop,
+                         size_t ringBytes = 1 << 20)
+        : _out(out), _policy(policy), _ringBytes(roundUpPowerOfTwo(ringBytes)), _id(nextId()),
+          _start(std::chrono::steady_clock::now()), _worker([this] { run(); }) {}
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    ~AsyncLogger() {
+        _running.store(false, std::memory_order_release);
+        _worker.join();
+        // Lets each producer thread release its ring on its next log call.
+        for (auto& ring : _rings) {
+            ring->orphaned.store(true, std::memory_order_release);
+        }
+    }
+
+    // Returns false if the record was dropped: the ring was full under the Drop
+    // policy, or the record is larger than the whole ring (either policy).
+    template <typename... Args>
+    bool log(LogLevel level, const char* fmt, const Args&... args) {
+        using logdetail::RecordHeader;
+        const size_t size = (sizeof(RecordHeader) + (size_t{0} + ... + logdetail::encodedSize(args)) + 7) & ~size_t{7};
+        logdetail::Ring& ring = localRing();
+        char* record = reserve(ring, size);
+        if (record == nullptr) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        RecordHeader header{static_cast<uint32_t>(size), level, &logdetail::formatRecord<logdetail::Stored<Args>...>, fmt,
+                            std::chrono::steady_clock::now().time_since_epoch().count()};
+        std::memcpy(record, &header, sizeof(header));
+        char* payload = record + sizeof(header);
+        (logdetail::encode(payload, args), ...);
+        (void)payload;
+        ring.head.store(ring.head.load(std::memory_order_relaxed) + size, std::memory_order_release);
+        return true;
+    }
+
+    template <typename... Args>
+    bool info(const char* fmt, const Args&... args) { return log(LogLevel::Info, fmt, args...); }
+    template <typename... Args>
+    bool warning(const char* fmt, const Args&... args) { return log(LogLevel::Warning, fmt, args...); }
+    template <typename... Args>
+    bool error(const char* fmt, const Args&... args) { return log(LogLevel::Error, fmt, args...); }
+
+    // Waits until everything logged before the call has been written out.
+    void flush() {
+        std::vector<std::pair<std::shared_ptr<logdetail::Ring>, size_t>> targets;
+        {
+            std::lock_guard<std::mutex> lock(_ringsMutex);
+            for (auto& ring : _rings) {
+                targets.emplace_back(ring, ring->head.load(std::memory_order_acquire));
+            }
+        }
+        for (auto& [ring, head] : targets) {
+            while (ring->tail.load(std::memory_order_acquire) < head) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    uint64_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+    uint64_t written() const { return _written.load(std::memory_order_relaxed); }
+
+private:
+    // Thread-side handle; only the live (not moved-from) one marks the ring abandoned.
+    struct LocalRing {
+        LocalRing(uint64_t id, std::shared_ptr<logdetail::Ring> r) : loggerId(id), ring(std::move(r)) {}
+        LocalRing(LocalRing&&) noexcept = default;
+        LocalRing& operator=(LocalRing&&) noexcept = default;
+        ~LocalRing() {
+            if (ring) {
+                ring->abandoned.store(true, std::memory_order_release);
+            }
+        }
+
+        uint64_t loggerId;
+        std::shared_ptr<logdetail::Ring> ring;
+    };
+
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
+
+    static size_t roundUpPowerOfTwo(size_t n) {
+        size_t p = 4096;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    // The calling thread's ring for this logger, registered on first use.
+    logdetail::Ring& localRing() {
+        thread_local std::vector<LocalRing> rings;
+        for (size_t i = 0; i < rings.size();) {
+            if (rings[i].loggerId == _id) {
+                return *rings[i].ring;
+            }
+            if (rings[i].ring->orphaned.load(std::memory_order_acquire)) {
+                if (i + 1 != rings.size()) {
+                    rings[i] = std::move(rings.back());
+                }
+                rings.pop_back();
+                continue;
+            }
+            ++i;
+        }
+        auto ring = std::make_shared<logdetail::Ring>(_ringBytes);
+        {
+            std::lock_guard<std::mutex> lock(_ringsMutex);
+            _rings.push_back(ring);
+        }
+        rings.emplace_back(_id, ring);
+        return *ring;
+    }
+
+    // Space for size contiguous bytes. A record that would straddle the end of
+    // the ring is preceded by padding up to the end, published on its own so
+    // the record only has to fit in an empty ring. Null if the record is
+    // larger than the ring, or if space runs out under the Drop policy.
+    char* reserve(logdetail::Ring& ring, size_t size) {
+        if (size > ring.capacity) {
+            return nullptr;
+        }
+        size_t head = ring.head.load(std::memory_order_relaxed);
+        const size_t offset = head & (ring.capacity - 1);
+        if (offset + size > ring.capacity) {
+            const size_t padding = ring.capacity - offset;
+            if (!waitForSpace(ring, head, padding)) {
+                return nullptr;
+            }
+            if (padding >= sizeof(logdetail::RecordHeader)) {
+                logdetail::RecordHeader marker{static_cast<uint32_t>(padding), LogLevel::Info, nullptr, nullptr, 0};
+                std::memcpy(ring.bytes() + offset, &marker, sizeof(marker));
+            }
+            head += padding;
+            ring.head.store(head, std::memory_order_release);
+        }
+        if (!waitForSpace(ring, head, size)) {
+            return nullptr;
+        }
+        return ring.bytes() + (head & (ring.capacity - 1));
+    }
+
+    // Waits (Block) or gives up (Drop) until n bytes past head are free.
+    bool waitForSpace(logdetail::Ring& ring, size_t head, size_t n) {
+        while (ring.capacity - (head - ring.tail.load(std::memory_order_acquire)) < n) {
+            if (_policy == OverflowPolicy::Drop) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // Formats everything currently in the ring into batch; returns the new tail.
+    size_t drain(logdetail::Ring& ring, std::string& batch) {
+        static const char* const levelNames[] = {"INFO", "WARN", "ERROR"};
+        size_t tail = ring.tail.load(std::memory_order_relaxed);
+        const size_t head = ring.head.load(std::memory_order_acquire);
+        while (tail < head) {
+            const size_t offset = tail & (ring.capacity - 1);
+            if (ring.capacity - offset < sizeof(logdetail::RecordHeader)) {
+                tail += ring.capacity - offset;
+                continue;
+            }
+            logdetail::RecordHeader header;
+            std::memcpy(&header, ring.bytes() + offset, sizeof(header));
+            if (header.format != nullptr) {
+                const double ms = (header.timestamp - _start.time_since_epoch().count()) / 1e6;
+                char stamp[32];
+                batch.append("[");
+                batch.append(levelNames[static_cast<int>(header.level)]);
+                batch.append(" +");
+                batch.append(stamp, std::to_chars(stamp, stamp + sizeof(stamp), ms, std::chars_format::fixed, 3).ptr);
+                batch.append("ms] ");
+                header.format(header.fmt, ring.bytes() + offset + sizeof(header), batch);
+                batch.push_back('\n');
+                _written.fetch_add(1, std::memory_order_relaxed);
+            }
+            tail += header.size;
+        }
+        return tail;
+    }
+
+    void run() {
+        std::string batch;
+        std::vector<std::pair<logdetail::Ring*, size_t>> drained;
+        for (;;) {
+            const bool stopping = !_running.load(std::memory_order_acquire);
+            bool idle = true;
+            {
+                std::lock_guard<std::mutex> lock(_ringsMutex);
+                for (auto& ring : _rings) {
+                    const size_t tail = drain(*ring, batch);
+                    idle = idle && tail == ring->tail.load(std::memory_order_relaxed);
+                    drained.emplace_back(ring.get(), tail);
+                }
+            }
+            if (!batch.empty()) {
+                std::fwrite(batch.data(), 1, batch.size(), _out);
+                std::fflush(_out);
+                batch.clear();
+            }
+            // Tails move only after the write, so flush() can wait on them.
+            for (auto& [ring, tail] : drained) {
+                ring->tail.store(tail, std::memory_order_release);
+            }
+            drained.clear();
+            {
+                std::lock_guard<std::mutex> lock(_ringsMutex);
+                _rings.erase(std::remove_if(_rings.begin(), _rings.end(),
+                                            [](const auto& ring) {
+                                                return ring->abandoned.load(std::memory_order_acquire) &&
+                                                       ring->tail.load() == ring->head.load();
+                                            }),
+                             _rings.end());
+            }
+            if (stopping) {
+                return;
+            }
+            if (idle) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    }
+
+    std::FILE* _out;
+    OverflowPolicy _policy;
+    size_t _ringBytes;
+    uint64_t _id;
+    std::chrono::steady_clock::time_point _start;
+    std::mutex _ringsMutex;
+    std::vector<std::shared_ptr<logdetail::Ring>> _rings;
+    std::atomic<bool> _running{true};
+    std::atomic<uint64_t> _dropped{0};
+    std::atomic<uint64_t> _written{0};
+    std::thread _worker;
+};
+
+// Caller-side cost per log call: synchronous ostream vs AsyncLogger. The burst
+// fits in the ring, so it measures the hot path alone; the sustained runs are
+// bounded by how fast the background thread can format.
+void loggerBenchmark() {
+    const int records = 1000000;
+    auto perCallNs = [&](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / records;
+    };
+
+    double syncNs;
+    {
+        std::ofstream sink("/dev/null");
+        syncNs = perCallNs([&] {
+            for (int i = 0; i < records; ++i) {
+                sink << "request " << i << " failed after " << i * 0.5 << " ms: " << "timeout" << std::endl;
+            }
+        });
+    }
+    std::cout << "std::ostream + std::endl: " << syncNs << " ns per call" << std::endl;
+
+    std::FILE* devNull = std::fopen("/dev/null", "w");
+    {
+        AsyncLogger logger(devNull, OverflowPolicy::Block, 4 << 20);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 20000; ++i) {
+            logger.error("request {} failed after {} ms: {}", i, i * 0.5, "timeout");
+        }
+        double burstNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / 20000;
+        logger.flush();
+        std::cout << "AsyncLogger (20K burst):  " << burstNs << " ns per call" << std::endl;
+        double asyncNs = perCallNs([&] {
+            for (int i = 0; i < records; ++i) {
+                logger.error("request {} failed after {} ms: {}", i, i * 0.5, "timeout");
+            }
+        });
+        logger.flush();
+        std::cout << "AsyncLogger (block):      " << asyncNs << " ns per call, " << logger.written() << " written" << std::endl;
+    }
+    {
+        AsyncLogger logger(devNull, OverflowPolicy::Drop, 64 << 10);
+        double asyncNs = perCallNs([&] {
+            for (int i = 0; i < records; ++i) {
+                logger.error("request {} failed after {} ms: {}", i, i * 0.5, "timeout");
+            }
+        });
+        logger.flush();
+        std::cout << "AsyncLogger (drop, 64KB): " << asyncNs << " ns per call, " << logger.written() << " written, "
+                  << logger.dropped() << " dropped" << std::endl;
+    }
+    std::fclose(devNull);
+}
+
 int main() {
+    AsyncLogger log;
     
     std::cout << "--- Basic Exception Example ---" << std::endl;
     try {
@@ -53,18 +485,18 @@ int main() {
         std::cout << "This will not be printed. Result: " << result << std::endl;
     } catch (const char* msg) {
         
-        std::cerr << "Error caught: " << msg << std::endl;
+        log.error("Error caught: {}", msg);
     }
 
-    
+    log.flush();
     std::cout << "\n--- Multiple/Standard Exceptions Example ---" << std::endl;
     try {
         checkValue(50);
         checkValue(-5); 
     } catch (const std::invalid_argument& e) {
-        std::cerr << "Caught an invalid_argument: " << e.what() << std::endl;
+        log.error("Caught an invalid_argument: {}", e.what());
     } catch (const std::out_of_range& e) {
-        std::cerr << "Caught an out_of_range: " << e.what() << std::endl;
+        log.error("Caught an out_of_range: {}", e.what());
     }
 
     
@@ -72,19 +504,23 @@ int main() {
         checkValue(42); 
     } catch (const std::exception& e) {
         
-        std::cerr << "Caught a standard exception: " << e.what() << std::endl;
+        log.error("Caught a standard exception: {}", e.what());
     } catch (...) { 
-        std::cerr << "Caught an unknown exception type!" << std::endl;
+        log.error("Caught an unknown exception type!");
     }
 
-    
+    log.flush();
     std::cout << "\n--- Custom Exception Example ---" << std::endl;
     std::vector<int> myData;
     try {
         processData(myData); 
     } catch (const MyCustomException& e) {
-        std::cerr << "Caught a custom exception: " << e.what() << std::endl;
+        log.error("Caught a custom exception: {}", e.what());
     }
+    log.flush();
+
+    std::cout << "\n--- Asynchronous Logging ---" << std::endl;
+    loggerBenchmark();
 
     return 0;
 }
\ No newline at end of file
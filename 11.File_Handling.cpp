@@ -1,12 +1,761 @@
 #include <iostream>
-#include <fstream> 
+#include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 
 const std::string FILENAME = "file_handling/meow.txt";
 
 
+// Long-lived append-only writer with group commit.
+// Records are copied into a large user-space buffer; a background thread writes
+// whatever has accumulated and issues a single fdatasync() for the whole batch.
+// append() returns a sequence number and waitDurable() blocks until that record
+// is on disk, so every caller still gets its own durability acknowledgement.
+// An I/O error is permanent: records not yet synced are never reported as
+// durable, and the writer refuses further records.
+class AppendWriter {
+public:
+    explicit AppendWriter(const std::string& path,
+                          size_t bufferSize = 1 << 20,
+                          std::chrono::milliseconds flushInterval = std::chrono::milliseconds(5))
+        : capacity_(bufferSize), interval_(flushInterval) {
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (fd_ < 0) {
+            failed_ = true;  // no flusher: append() refuses and waits return at once
+            return;
+        }
+        active_.reserve(capacity_);
+        flushing_.reserve(capacity_);
+        flusher_ = std::thread(&AppendWriter::flusherLoop, this);
+    }
+
+    ~AppendWriter() {
+        if (fd_ < 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stop_ = true;
+        }
+        dataReady_.notify_one();
+        flusher_.join();
+        ::close(fd_);
+    }
+
+    AppendWriter(const AppendWriter&) = delete;
+    AppendWriter& operator=(const AppendWriter&) = delete;
+
+    bool is_open() const { return fd_ >= 0; }
+
+    // Buffers the record (written verbatim, the caller supplies the newline) and
+    // returns its sequence number. Blocks only when the buffer is full. Returns 0
+    // without buffering anything once the writer has failed.
+    uint64_t append(std::string_view record) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        durable_.wait(lock, [&] {
+            return failed_ || active_.empty() || active_.size() + record.size() <= capacity_;
+        });
+        if (failed_) {
+            return 0;
+        }
+        active_.append(record.data(), record.size());
+        uint64_t seq = ++appendedSeq_;
+        if (active_.size() >= capacity_ / 2) {
+            dataReady_.notify_one();
+        }
+        return seq;
+    }
+
+    // Returns true once the record with this sequence number has been synced,
+    // false if the writer has hit an I/O error (or seq is 0, a refused append).
+    bool waitDurable(uint64_t seq) {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (failed_ || seq == 0) {
+            return false;
+        }
+        if (durableSeq_ >= seq) {
+            return true;
+        }
+        ++waiters_;
+        dataReady_.notify_one();
+        durable_.wait(lock, [&] { return failed_ || durableSeq_ >= seq; });
+        --waiters_;
+        return !failed_ && durableSeq_ >= seq;
+    }
+
+    bool appendDurable(std::string_view record) {
+        return waitDurable(append(record));
+    }
+
+    // Waits until everything appended so far is on disk.
+    bool flush() {
+        uint64_t seq;
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            seq = appendedSeq_;
+        }
+        return waitDurable(seq);
+    }
+
+    uint64_t recordCount() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return appendedSeq_;
+    }
+
+    uint64_t syncCount() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return syncs_;
+    }
+
+private:
+    void flusherLoop() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        while (true) {
+            dataReady_.wait_for(lock, interval_, [&] {
+                return stop_ || (!active_.empty() && (waiters_ > 0 || active_.size() >= capacity_ / 2));
+            });
+            if (active_.empty()) {
+                if (stop_) {
+                    break;
+                }
+                continue;
+            }
+
+            // Take the whole batch; writers keep filling the other buffer meanwhile.
+            flushing_.swap(active_);
+            uint64_t batchEnd = appendedSeq_;
+            lock.unlock();
+            durable_.notify_all();
+
+            bool ok = writeAll(flushing_) && ::fdatasync(fd_) == 0;
+            int error = ok ? 0 : errno;
+            flushing_.clear();
+
+            lock.lock();
+            if (ok && !failed_) {
+                durableSeq_ = batchEnd;
+                ++syncs_;
+            } else if (!ok) {
+                // durableSeq_ stays where it is for good; anything buffered is dropped.
+                failed_ = true;
+                active_.clear();
+                std::cerr << "Error: AppendWriter failed to persist batch (errno " << error << ")." << std::endl;
+            }
+            durable_.notify_all();
+        }
+    }
+
+    bool writeAll(const std::string& data) {
+        const char* p = data.data();
+        size_t left = data.size();
+        while (left > 0) {
+            ssize_t n = ::write(fd_, p, left);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            p += n;
+            left -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    int fd_ = -1;
+    size_t capacity_;
+    std::chrono::milliseconds interval_;
+    std::string active_;
+    std::string flushing_;
+    uint64_t appendedSeq_ = 0;
+    uint64_t durableSeq_ = 0;
+    uint64_t syncs_ = 0;
+    int waiters_ = 0;
+    bool failed_ = false;
+    bool stop_ = false;
+    mutable std::mutex mtx_;
+    std::condition_variable dataReady_;
+    std::condition_variable durable_;
+    std::thread flusher_;
+};
+
+
+// Read-only memory mapping of a whole file. An empty file opens successfully
+// with an empty view.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            if (st.st_size == 0) {
+                open_ = true;
+            } else {
+                void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    data_ = static_cast<const char*>(p);
+                    size_ = static_cast<size_t>(st.st_size);
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+                    open_ = true;
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool is_open() const { return open_; }
+    std::string_view view() const { return {data_, size_}; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool open_ = false;
+};
+
+
+// --- Columnar binary file format ---
+// Layout (every section starts on a 64-byte boundary):
+//   header : ColumnarHeader, then per column {type, encoding, nameLength, name}
+//   blocks : one block per column per row group, written as the rows stream in
+//   footer : BlockIndexEntry[blockCount]
+//   trailer: ColumnarTrailer, always the last 32 bytes of the file
+// Numbers are stored in the writing host's byte order, because Plain blocks are
+// raw arrays that the reader hands out straight from the mapping; files are not
+// portable between little- and big-endian hosts. DeltaBitPacked integer blocks store the differences between
+// consecutive values, minus the smallest difference, packed at a fixed bit width.
+enum class ColumnType : uint8_t { Int64 = 1, Float64 = 2 };
+enum class ColumnEncoding : uint8_t { Plain = 0, DeltaBitPacked = 1 };
+
+struct ColumnSpec {
+    std::string name;
+    ColumnType type;
+    ColumnEncoding encoding = ColumnEncoding::Plain;
+};
+
+constexpr char COLUMNAR_MAGIC[8] = {'C', 'P', 'A', 'C', 'O', 'L', '1', '\0'};
+constexpr size_t COLUMNAR_ALIGNMENT = 64;
+
+struct ColumnarHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numColumns;
+};
+
+struct BlockIndexEntry {
+    uint32_t column;
+    uint32_t rows;
+    uint64_t offset;
+    uint64_t bytes;
+    int64_t base;      // first value of the block (DeltaBitPacked)
+    int64_t minDelta;  // subtracted from every delta before packing
+    uint8_t encoding;
+    uint8_t bitWidth;
+    uint8_t padding[6];
+};
+
+struct ColumnarTrailer {
+    uint64_t footerOffset;
+    uint64_t blockCount;
+    uint64_t rowCount;
+    char magic[8];
+};
+
+static_assert(sizeof(BlockIndexEntry) == 48, "BlockIndexEntry is part of the file format");
+static_assert(sizeof(ColumnarTrailer) == 32, "ColumnarTrailer is part of the file format");
+
+inline uint64_t readPackedBits(const uint64_t* words, size_t index, unsigned width) {
+    if (width == 0) {
+        return 0;
+    }
+    size_t bit = index * width;
+    size_t word = bit >> 6;
+    unsigned shift = bit & 63;
+    uint64_t value = words[word] >> shift;
+    if (shift + width > 64) {
+        value |= words[word + 1] << (64 - shift);
+    }
+    return width == 64 ? value : value & ((uint64_t{1} << width) - 1);
+}
+
+// A value for one cell of a row; converted to the column's type on append.
+struct ColumnarCell {
+    ColumnarCell(int v) : isDouble(false), i(v), d(v) {}
+    ColumnarCell(int64_t v) : isDouble(false), i(v), d(static_cast<double>(v)) {}
+    ColumnarCell(double v) : isDouble(true), i(static_cast<int64_t>(v)), d(v) {}
+    bool isDouble;
+    int64_t i;
+    double d;
+};
+
+// Streaming writer: rows are buffered per column and flushed as one block per
+// column every rowsPerBlock rows, so memory use stays bounded. The file is not
+// created (is_open() is false) if the schema is empty, a column name is longer
+// than 65535 bytes, or rowsPerBlock is 0 or does not fit the 32-bit row count.
+class ColumnarWriter {
+public:
+    ColumnarWriter(const std::string& path, std::vector<ColumnSpec> schema, size_t rowsPerBlock = 65536)
+        : schema_(std::move(schema)), rowsPerBlock_(rowsPerBlock), columns_(schema_.size()) {
+        if (schema_.empty() || schema_.size() > UINT32_MAX || rowsPerBlock_ == 0 || rowsPerBlock_ > UINT32_MAX) {
+            return;
+        }
+        for (const auto& col : schema_) {
+            if (col.name.size() > UINT16_MAX) {
+                return;
+            }
+        }
+        out_.open(path, std::ios::binary | std::ios::trunc);
+        if (!out_.is_open()) {
+            return;
+        }
+        ColumnarHeader header{};
+        std::memcpy(header.magic, COLUMNAR_MAGIC, sizeof(header.magic));
+        header.version = 1;
+        header.numColumns = static_cast<uint32_t>(schema_.size());
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& col : schema_) {
+            uint8_t typeAndEncoding[2] = {static_cast<uint8_t>(col.type), static_cast<uint8_t>(col.encoding)};
+            uint16_t nameLength = static_cast<uint16_t>(col.name.size());
+            out_.write(reinterpret_cast<const char*>(typeAndEncoding), sizeof(typeAndEncoding));
+            out_.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+            out_.write(col.name.data(), nameLength);
+        }
+        for (auto& values : columns_) {
+            values.reserve(rowsPerBlock_);
+        }
+    }
+
+    ~ColumnarWriter() { close(); }
+
+    bool is_open() const { return out_.is_open(); }
+
+    // Appends one row; returns false if the writer is not open or the cell count
+    // does not match the schema.
+    bool appendRow(std::initializer_list<ColumnarCell> row) {
+        if (!out_.is_open() || row.size() != schema_.size()) {
+            return false;
+        }
+        size_t c = 0;
+        for (const ColumnarCell& cell : row) {
+            uint64_t bits;
+            if (schema_[c].type == ColumnType::Float64) {
+                std::memcpy(&bits, &cell.d, sizeof(bits));
+            } else {
+                bits = static_cast<uint64_t>(cell.i);
+            }
+            columns_[c++].push_back(bits);
+        }
+        if (columns_[0].size() == rowsPerBlock_) {
+            flushBlocks();
+        }
+        return true;
+    }
+
+    // Writes the remaining rows, the footer index and the trailer.
+    bool close() {
+        if (!out_.is_open()) {
+            return false;
+        }
+        flushBlocks();
+        padToAlignment();
+        ColumnarTrailer trailer{};
+        trailer.footerOffset = static_cast<uint64_t>(out_.tellp());
+        trailer.blockCount = index_.size();
+        trailer.rowCount = rowCount_;
+        std::memcpy(trailer.magic, COLUMNAR_MAGIC, sizeof(trailer.magic));
+        out_.write(reinterpret_cast<const char*>(index_.data()), static_cast<std::streamsize>(index_.size() * sizeof(BlockIndexEntry)));
+        out_.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+        bool ok = static_cast<bool>(out_);
+        out_.close();
+        return ok;
+    }
+
+private:
+    void padToAlignment() {
+        static const char zeros[COLUMNAR_ALIGNMENT] = {};
+        size_t pos = static_cast<size_t>(out_.tellp());
+        size_t pad = (COLUMNAR_ALIGNMENT - pos % COLUMNAR_ALIGNMENT) % COLUMNAR_ALIGNMENT;
+        out_.write(zeros, static_cast<std::streamsize>(pad));
+    }
+
+    void flushBlocks() {
+        size_t rows = columns_.empty() ? 0 : columns_[0].size();
+        if (rows == 0) {
+            return;
+        }
+        for (size_t c = 0; c < schema_.size(); ++c) {
+            padToAlignment();
+            BlockIndexEntry entry{};
+            entry.column = static_cast<uint32_t>(c);
+            entry.rows = static_cast<uint32_t>(rows);
+            entry.offset = static_cast<uint64_t>(out_.tellp());
+            entry.encoding = static_cast<uint8_t>(schema_[c].encoding);
+
+            const std::vector<uint64_t>& values = columns_[c];
+            if (schema_[c].encoding == ColumnEncoding::DeltaBitPacked && schema_[c].type == ColumnType::Int64) {
+                std::vector<uint64_t> packed = deltaBitPack(values, entry);
+                entry.bytes = packed.size() * sizeof(uint64_t);
+                out_.write(reinterpret_cast<const char*>(packed.data()), static_cast<std::streamsize>(entry.bytes));
+            } else {
+                entry.encoding = static_cast<uint8_t>(ColumnEncoding::Plain);
+                entry.bytes = values.size() * sizeof(uint64_t);
+                out_.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(entry.bytes));
+            }
+            index_.push_back(entry);
+            columns_[c].clear();
+        }
+        rowCount_ += rows;
+    }
+
+    static std::vector<uint64_t> deltaBitPack(const std::vector<uint64_t>& values, BlockIndexEntry& entry) {
+        entry.base = static_cast<int64_t>(values[0]);
+        int64_t minDelta = 0;
+        for (size_t i = 1; i < values.size(); ++i) {
+            int64_t delta = static_cast<int64_t>(values[i] - values[i - 1]);
+            minDelta = (i == 1) ? delta : std::min(minDelta, delta);
+        }
+        uint64_t maxStored = 0;
+        for (size_t i = 1; i < values.size(); ++i) {
+            maxStored = std::max(maxStored, values[i] - values[i - 1] - static_cast<uint64_t>(minDelta));
+        }
+        unsigned width = 0;
+        while (width < 64 && (maxStored >> width) != 0) {
+            ++width;
+        }
+        entry.minDelta = minDelta;
+        entry.bitWidth = static_cast<uint8_t>(width);
+
+        size_t count = values.size() - 1;
+        std::vector<uint64_t> words((count * width + 63) / 64, 0);
+        for (size_t i = 0; i < count && width > 0; ++i) {
+            uint64_t stored = values[i + 1] - values[i] - static_cast<uint64_t>(minDelta);
+            size_t bit = i * width;
+            size_t word = bit >> 6;
+            unsigned shift = bit & 63;
+            words[word] |= stored << shift;
+            if (shift + width > 64) {
+                words[word + 1] |= stored >> (64 - shift);
+            }
+        }
+        return words;
+    }
+
+    std::ofstream out_;
+    std::vector<ColumnSpec> schema_;
+    size_t rowsPerBlock_;
+    std::vector<std::vector<uint64_t>> columns_;
+    std::vector<BlockIndexEntry> index_;
+    uint64_t rowCount_ = 0;
+};
+
+// Contiguous values inside the mapping; valid as long as the reader lives.
+template <typename T>
+struct ColumnSlice {
+    const T* data = nullptr;
+    size_t size = 0;
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+};
+
+// Maps a columnar file and exposes its blocks in place. Only the schema names
+// are copied; the block index and Plain block contents are read straight from
+// the mapping.
+class ColumnarReader {
+public:
+    explicit ColumnarReader(const std::string& path) : file_(path) {
+        if (!file_.is_open()) {
+            return;
+        }
+        std::string_view data = file_.view();
+        if (data.size() < sizeof(ColumnarHeader) + sizeof(ColumnarTrailer)) {
+            return;
+        }
+        const auto* header = reinterpret_cast<const ColumnarHeader*>(data.data());
+        trailer_ = reinterpret_cast<const ColumnarTrailer*>(data.data() + data.size() - sizeof(ColumnarTrailer));
+        if (std::memcmp(header->magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) != 0 ||
+            std::memcmp(trailer_->magic, COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC)) != 0 ||
+            trailer_->blockCount > data.size() / sizeof(BlockIndexEntry) ||
+            trailer_->footerOffset + trailer_->blockCount * sizeof(BlockIndexEntry) + sizeof(ColumnarTrailer) != data.size() ||
+            trailer_->footerOffset % COLUMNAR_ALIGNMENT != 0) {
+            return;
+        }
+        const uint64_t footerOffset = trailer_->footerOffset;
+
+        size_t pos = sizeof(ColumnarHeader);
+        for (uint32_t c = 0; c < header->numColumns; ++c) {
+            if (pos + 4 > footerOffset) {
+                return;
+            }
+            uint16_t nameLength;
+            std::memcpy(&nameLength, data.data() + pos + 2, sizeof(nameLength));
+            if (pos + 4 + nameLength > footerOffset) {
+                return;
+            }
+            ColumnSpec spec;
+            spec.type = static_cast<ColumnType>(data[pos]);
+            spec.encoding = static_cast<ColumnEncoding>(data[pos + 1]);
+            if (spec.type != ColumnType::Int64 && spec.type != ColumnType::Float64) {
+                return;
+            }
+            spec.name.assign(data.data() + pos + 4, nameLength);
+            schema_.push_back(std::move(spec));
+            pos += 4 + nameLength;
+        }
+
+        // Every block must lie between the header and the footer, on an aligned
+        // offset, and hold as many values as its row count says.
+        index_ = reinterpret_cast<const BlockIndexEntry*>(data.data() + footerOffset);
+        for (uint64_t b = 0; b < trailer_->blockCount; ++b) {
+            const BlockIndexEntry& e = index_[b];
+            if (e.column >= schema_.size() || e.offset < pos || e.offset % COLUMNAR_ALIGNMENT != 0 ||
+                e.offset > footerOffset || e.bytes > footerOffset - e.offset) {
+                return;
+            }
+            uint64_t needed;
+            if (e.encoding == static_cast<uint8_t>(ColumnEncoding::Plain)) {
+                needed = uint64_t{e.rows} * sizeof(uint64_t);
+            } else if (e.encoding == static_cast<uint8_t>(ColumnEncoding::DeltaBitPacked) &&
+                       schema_[e.column].type == ColumnType::Int64 && e.rows > 0 && e.bitWidth <= 64) {
+                needed = ((uint64_t{e.rows} - 1) * e.bitWidth + 63) / 64 * sizeof(uint64_t);
+            } else {
+                return;
+            }
+            if (e.bytes < needed) {
+                return;
+            }
+        }
+        valid_ = true;
+    }
+
+    bool is_open() const { return valid_; }
+    const std::vector<ColumnSpec>& schema() const { return schema_; }
+    uint64_t rowCount() const { return valid_ ? trailer_->rowCount : 0; }
+
+    int columnIndex(std::string_view name) const {
+        for (size_t c = 0; c < schema_.size(); ++c) {
+            if (schema_[c].name == name) {
+                return static_cast<int>(c);
+            }
+        }
+        return -1;
+    }
+
+    // Zero-copy view of every Plain block of a column, in row order. Empty if
+    // the column does not exist or T is not its stored type.
+    template <typename T>
+    std::vector<ColumnSlice<T>> plainBlocks(size_t column) const {
+        static_assert(std::is_same_v<T, int64_t> || std::is_same_v<T, double>, "columns hold int64_t or double");
+        constexpr ColumnType type = std::is_same_v<T, double> ? ColumnType::Float64 : ColumnType::Int64;
+        std::vector<ColumnSlice<T>> slices;
+        if (column >= schema_.size() || schema_[column].type != type) {
+            return slices;
+        }
+        for (uint64_t b = 0; valid_ && b < trailer_->blockCount; ++b) {
+            const BlockIndexEntry& e = index_[b];
+            if (e.column == column && e.encoding == static_cast<uint8_t>(ColumnEncoding::Plain)) {
+                slices.push_back({reinterpret_cast<const T*>(file_.view().data() + e.offset), e.rows});
+            }
+        }
+        return slices;
+    }
+
+    // Calls fn(value) for every int64 in the column, decoding packed blocks on the fly.
+    template <typename Fn>
+    void forEachInt64(size_t column, Fn fn) const {
+        if (column >= schema_.size() || schema_[column].type != ColumnType::Int64) {
+            return;
+        }
+        for (uint64_t b = 0; valid_ && b < trailer_->blockCount; ++b) {
+            const BlockIndexEntry& e = index_[b];
+            if (e.column != column) {
+                continue;
+            }
+            const char* block = file_.view().data() + e.offset;
+            if (e.encoding == static_cast<uint8_t>(ColumnEncoding::Plain)) {
+                const auto* values = reinterpret_cast<const int64_t*>(block);
+                for (uint32_t i = 0; i < e.rows; ++i) {
+                    fn(values[i]);
+                }
+            } else {
+                const auto* words = reinterpret_cast<const uint64_t*>(block);
+                uint64_t value = static_cast<uint64_t>(e.base);
+                fn(e.base);
+                for (uint32_t i = 1; i < e.rows; ++i) {
+                    value += readPackedBits(words, i - 1, e.bitWidth) + static_cast<uint64_t>(e.minDelta);
+                    fn(static_cast<int64_t>(value));
+                }
+            }
+        }
+    }
+
+private:
+    MappedFile file_;
+    std::vector<ColumnSpec> schema_;
+    const ColumnarTrailer* trailer_ = nullptr;
+    const BlockIndexEntry* index_ = nullptr;
+    bool valid_ = false;
+};
+
+
+// --- Parallel chunked processing ---
+// The file is split into roughly equal byte ranges whose ends are moved forward
+// to the next '\n', so no line straddles two chunks. Each chunk is processed on
+// its own thread and the per-chunk results come back in file order.
+std::vector<std::string_view> splitAtLineBoundaries(std::string_view data, size_t numChunks) {
+    std::vector<std::string_view> chunks;
+    if (data.empty()) {
+        return chunks;
+    }
+    size_t target = data.size() / std::max<size_t>(numChunks, 1) + 1;
+    size_t begin = 0;
+    while (begin < data.size()) {
+        size_t end = begin + target;
+        if (end >= data.size()) {
+            end = data.size();
+        } else {
+            size_t nl = data.find('\n', end - 1);
+            end = (nl == std::string_view::npos) ? data.size() : nl + 1;
+        }
+        chunks.push_back(data.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+template <typename Fn>
+auto mapChunksInParallel(std::string_view data, unsigned numThreads, Fn fn) {
+    using Result = decltype(fn(std::string_view{}));
+    std::vector<std::string_view> chunks = splitAtLineBoundaries(data, numThreads);
+    std::vector<Result> results(chunks.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        threads.emplace_back([&, i] { results[i] = fn(chunks[i]); });
+    }
+    if (!chunks.empty()) {
+        results[0] = fn(chunks[0]);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return results;
+}
+
+template <typename Fn>
+void forEachLine(std::string_view chunk, Fn fn) {
+    size_t begin = 0;
+    while (begin < chunk.size()) {
+        size_t nl = chunk.find('\n', begin);
+        size_t end = (nl == std::string_view::npos) ? chunk.size() : nl;
+        fn(chunk.substr(begin, end - begin));
+        begin = end + 1;
+    }
+}
+
+size_t countLinesInChunk(std::string_view chunk) {
+    size_t lines = static_cast<size_t>(std::count(chunk.begin(), chunk.end(), '\n'));
+    if (!chunk.empty() && chunk.back() != '\n') {
+        ++lines;
+    }
+    return lines;
+}
+
+size_t parallelCountLines(std::string_view data, unsigned numThreads) {
+    size_t total = 0;
+    for (size_t n : mapChunksInParallel(data, numThreads, countLinesInChunk)) {
+        total += n;
+    }
+    return total;
+}
+
+struct GrepMatch {
+    size_t lineNumber; // 1-based, across the whole file
+    std::string_view line;
+};
+
+std::vector<GrepMatch> parallelGrep(std::string_view data, std::string_view needle, unsigned numThreads) {
+    struct ChunkMatches {
+        size_t lines = 0;
+        std::vector<GrepMatch> matches; // line numbers local to the chunk
+    };
+    auto perChunk = mapChunksInParallel(data, numThreads, [needle](std::string_view chunk) {
+        ChunkMatches result;
+        forEachLine(chunk, [&](std::string_view line) {
+            ++result.lines;
+            if (line.find(needle) != std::string_view::npos) {
+                result.matches.push_back({result.lines, line});
+            }
+        });
+        return result;
+    });
+
+    std::vector<GrepMatch> merged;
+    size_t lineOffset = 0;
+    for (const auto& chunk : perChunk) {
+        for (const auto& m : chunk.matches) {
+            merged.push_back({m.lineNumber + lineOffset, m.line});
+        }
+        lineOffset += chunk.lines;
+    }
+    return merged;
+}
+
+// Returns the field at fieldIndex (0-based) of every line; lines with fewer
+// fields yield an empty view so the output stays aligned with the input.
+std::vector<std::string_view> parallelExtractField(std::string_view data, size_t fieldIndex, char delimiter, unsigned numThreads) {
+    auto perChunk = mapChunksInParallel(data, numThreads, [=](std::string_view chunk) {
+        std::vector<std::string_view> fields;
+        forEachLine(chunk, [&](std::string_view line) {
+            size_t begin = 0;
+            for (size_t i = 0; i < fieldIndex && begin != std::string_view::npos; ++i) {
+                size_t d = line.find(delimiter, begin);
+                begin = (d == std::string_view::npos) ? d : d + 1;
+            }
+            if (begin == std::string_view::npos) {
+                fields.emplace_back();
+                return;
+            }
+            size_t end = line.find(delimiter, begin);
+            fields.push_back(line.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin));
+        });
+        return fields;
+    });
+
+    std::vector<std::string_view> merged;
+    for (auto& chunk : perChunk) {
+        merged.insert(merged.end(), chunk.begin(), chunk.end());
+    }
+    return merged;
+}
+
+
 void writeToFile() {
     
     
@@ -18,9 +767,10 @@ void writeToFile() {
     }
 
     std::cout << "Writing to file: " << FILENAME << std::endl;
-    outFile << "Hello from the C++ program!" << std::endl;
-    outFile << "This is the first line." << std::endl;
-    outFile << "This is the second line." << std::endl;
+    // '\n' instead of std::endl: the stream flushes once when it is closed.
+    outFile << "Hello from the C++ program!\n";
+    outFile << "This is the first line.\n";
+    outFile << "This is the second line.\n";
 
     
     std::cout << "Finished writing." << std::endl;
@@ -48,19 +798,170 @@ void readFromFile() {
 
 void appendToFile() {
     
-    std::ofstream outFile(FILENAME, std::ios::app);
+    AppendWriter writer(FILENAME);
 
-    if (!outFile.is_open()) {
+    if (!writer.is_open()) {
         std::cerr << "Error: Could not open the file for appending." << std::endl;
         return;
     }
 
     std::cout << "\nAppending to file: " << FILENAME << std::endl;
-    outFile << "This is an appended line." << std::endl;
-    outFile << "Another appended line." << std::endl;
+    writer.append("This is an appended line.\n");
+    writer.append("Another appended line.\n");
+    if (!writer.flush()) {
+        std::cerr << "Error: Appended lines were not persisted." << std::endl;
+        return;
+    }
     std::cout << "Finished appending." << std::endl;
 }
 
+void groupCommitExample() {
+    const std::string auditFile = "file_handling/audit.log";
+    const int numThreads = 8;
+    const int recordsPerThread = 250;
+
+    std::cout << "\nGroup commit: " << numThreads << " threads, each waiting for every record to be durable" << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    {
+        AppendWriter writer(auditFile);
+        if (!writer.is_open()) {
+            std::cerr << "Error: Could not open the audit log." << std::endl;
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&writer, t] {
+                for (int i = 0; i < recordsPerThread; ++i) {
+                    std::string record = "thread " + std::to_string(t) + " record " + std::to_string(i) + "\n";
+                    writer.appendDurable(record);
+                }
+            });
+        }
+        for (auto& th : threads) {
+            th.join();
+        }
+
+        std::cout << "Records: " << writer.recordCount() << ", fdatasync calls: " << writer.syncCount() << std::endl;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Elapsed: " << elapsed.count() << " ms" << std::endl;
+    std::remove(auditFile.c_str());
+}
+
+void parallelChunkExample() {
+    const std::string csvFile = "file_handling/big.csv";
+    const int numRows = 500000;
+    {
+        std::ofstream out(csvFile);
+        if (!out.is_open()) {
+            std::cerr << "Error: Could not create the CSV file." << std::endl;
+            return;
+        }
+        for (int i = 0; i < numRows; ++i) {
+            out << i << ",user" << (i % 1000) << "," << (i % 7 == 0 ? "ERROR" : "ok") << "," << (i * 31 % 997) << '\n';
+        }
+    }
+
+    MappedFile file(csvFile);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not map the CSV file." << std::endl;
+        return;
+    }
+    std::string_view data = file.view();
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "\nParallel chunked processing of " << data.size() << " bytes" << std::endl;
+    for (unsigned threads : {1u, cores}) {
+        auto start = std::chrono::steady_clock::now();
+        size_t lines = parallelCountLines(data, threads);
+        std::vector<GrepMatch> errors = parallelGrep(data, "ERROR", threads);
+        std::vector<std::string_view> amounts = parallelExtractField(data, 3, ',', threads);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << threads << " thread(s): " << lines << " lines, " << errors.size() << " ERROR lines (first at line "
+                  << (errors.empty() ? 0 : errors.front().lineNumber) << "), " << amounts.size()
+                  << " fields extracted, last = " << (amounts.empty() ? "" : std::string(amounts.back()))
+                  << ", " << elapsed.count() << " ms" << std::endl;
+    }
+    std::remove(csvFile.c_str());
+}
+
+void columnarFileExample() {
+    const std::string colFile = "file_handling/prices.col";
+    const std::string textFile = "file_handling/prices.txt";
+    const int numRows = 1000000;
+
+    std::cout << "\nColumnar binary format vs text for " << numRows << " rows" << std::endl;
+    {
+        ColumnarWriter writer(colFile, {{"timestamp", ColumnType::Int64, ColumnEncoding::DeltaBitPacked},
+                                        {"quantity", ColumnType::Int64, ColumnEncoding::Plain},
+                                        {"price", ColumnType::Float64, ColumnEncoding::Plain}});
+        std::ofstream text(textFile);
+        if (!writer.is_open() || !text.is_open()) {
+            std::cerr << "Error: Could not create the output files." << std::endl;
+            return;
+        }
+        for (int i = 0; i < numRows; ++i) {
+            int64_t timestamp = 1700000000000LL + i * 10 + (i % 3);
+            int64_t quantity = i % 500;
+            double price = 100.0 + (i % 1000) * 0.25;
+            writer.appendRow({timestamp, quantity, price});
+            text << timestamp << ' ' << quantity << ' ' << price << '\n';
+        }
+        if (!writer.close()) {
+            std::cerr << "Error: Could not finish the columnar file." << std::endl;
+            return;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t textQuantity = 0;
+    double textPrice = 0.0;
+    {
+        std::ifstream text(textFile);
+        int64_t timestamp, quantity;
+        double price;
+        while (text >> timestamp >> quantity >> price) {
+            textQuantity += quantity;
+            textPrice += price;
+        }
+    }
+    auto textTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    ColumnarReader reader(colFile);
+    if (!reader.is_open()) {
+        std::cerr << "Error: Could not open the columnar file." << std::endl;
+        return;
+    }
+    int64_t colQuantity = 0;
+    double colPrice = 0.0;
+    int64_t lastTimestamp = 0;
+    for (const auto& block : reader.plainBlocks<int64_t>(reader.columnIndex("quantity"))) {
+        for (int64_t q : block) {
+            colQuantity += q;
+        }
+    }
+    for (const auto& block : reader.plainBlocks<double>(reader.columnIndex("price"))) {
+        for (double p : block) {
+            colPrice += p;
+        }
+    }
+    reader.forEachInt64(reader.columnIndex("timestamp"), [&](int64_t ts) { lastTimestamp = ts; });
+    auto colTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::ifstream colSize(colFile, std::ios::binary | std::ios::ate);
+    std::ifstream textSize(textFile, std::ios::binary | std::ios::ate);
+    std::cout << "Text:     " << textSize.tellg() << " bytes, parsed in " << textTime.count() << " ms, quantity sum = "
+              << textQuantity << ", price sum = " << textPrice << std::endl;
+    std::cout << "Columnar: " << colSize.tellg() << " bytes, read in " << colTime.count() << " ms, quantity sum = "
+              << colQuantity << ", price sum = " << colPrice << ", rows = " << reader.rowCount()
+              << ", last timestamp = " << lastTimestamp << std::endl;
+    std::remove(colFile.c_str());
+    std::remove(textFile.c_str());
+}
+
 int main() {
     
     writeToFile();
@@ -73,5 +974,11 @@ int main() {
     
     readFromFile();
 
+    groupCommitExample();
+
+    parallelChunkExample();
+
+    columnarFileExample();
+
     return 0;
 }
\ No newline at end of file
@@ -4,6 +4,12 @@
 #include <memory>
 #include <algorithm>
 #include <map>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <thread>
 
 // --- Key Features of C++11 and C++14 ---
 
@@ -61,21 +67,182 @@ void smartPointerExample() {
 }
 
 // 5. Move Semantics and Rvalue References
+
+// Process-wide pool of int arrays in power-of-two size classes (4 KB .. 64 MB).
+// Released storage goes to a cache owned by the releasing thread, so reuse
+// needs no locking; only the statistics are shared atomics. A cache keeps at
+// most as many blocks as the thread actually needed: trim() frees blocks that
+// were never taken since the previous trim (the cache's low-water mark), and
+// runs automatically every kTrimInterval acquisitions. Recycled storage is not
+// zeroed.
+class BufferPool {
+public:
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t trimmedBytes;
+        size_t retainedBytes;
+        double hitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses); }
+    };
+
+    static BufferPool& instance() {
+        static BufferPool pool;
+        return pool;
+    }
+
+    // Returns storage for at least size ints; capacity receives the class size
+    // (0 if the request is too large to pool and was allocated directly).
+    int* acquire(size_t size, size_t& capacity) {
+        const size_t index = classIndex(size);
+        if (index >= kClasses) {
+            capacity = 0;
+            return new int[size];
+        }
+        capacity = kMinCapacity << index;
+        ThreadCache& cache = localCache();
+        if (++cache.sinceTrim >= kTrimInterval) {
+            trim();
+        }
+        ClassCache& cls = cache.classes[index];
+        if (cls.free.empty()) {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return new int[capacity];
+        }
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        int* data = cls.free.back();
+        cls.free.pop_back();
+        cls.lowWater = std::min(cls.lowWater, cls.free.size());
+        _retainedBytes.fetch_sub(capacity * sizeof(int), std::memory_order_relaxed);
+        return data;
+    }
+
+    void release(int* data, size_t capacity) {
+        const size_t bytes = capacity * sizeof(int);
+        if (capacity == 0 || _retainedBytes.load(std::memory_order_relaxed) + bytes > _maxRetainedBytes.load(std::memory_order_relaxed)) {
+            delete[] data;
+            return;
+        }
+        localCache().classes[classIndex(capacity)].free.push_back(data);
+        _retainedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    // Frees this thread's idle blocks (see class comment).
+    void trim() {
+        ThreadCache& cache = localCache();
+        cache.sinceTrim = 0;
+        for (size_t index = 0; index < kClasses; ++index) {
+            ClassCache& cls = cache.classes[index];
+            const size_t bytes = (kMinCapacity << index) * sizeof(int);
+            for (size_t i = 0; i < cls.lowWater; ++i) {
+                delete[] cls.free.back();
+                cls.free.pop_back();
+                _retainedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+                _trimmedBytes.fetch_add(bytes, std::memory_order_relaxed);
+            }
+            cls.lowWater = cls.free.size();
+        }
+    }
+
+    void setMaxRetainedBytes(size_t bytes) { _maxRetainedBytes.store(bytes, std::memory_order_relaxed); }
+
+    Stats stats() const {
+        return Stats{_hits.load(), _misses.load(), _trimmedBytes.load(), _retainedBytes.load()};
+    }
+
+private:
+    static constexpr size_t kMinCapacity = 1024;  // ints, i.e. 4 KB
+    static constexpr size_t kClasses = 15;        // up to 16M ints, i.e. 64 MB
+    static constexpr size_t kTrimInterval = 4096;
+
+    struct ClassCache {
+        std::vector<int*> free;
+        size_t lowWater = 0;
+    };
+
+    struct ThreadCache {
+        std::array<ClassCache, kClasses> classes;
+        size_t sinceTrim = 0;
+
+        ~ThreadCache() {
+            for (size_t index = 0; index < kClasses; ++index) {
+                for (int* data : classes[index].free) {
+                    delete[] data;
+                    BufferPool::instance()._retainedBytes.fetch_sub((kMinCapacity << index) * sizeof(int), std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    BufferPool() = default;
+
+    static ThreadCache& localCache() {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    static size_t classIndex(size_t size) {
+        size_t index = 0;
+        while ((kMinCapacity << index) < size && index < kClasses) {
+            ++index;
+        }
+        return index;
+    }
+
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _trimmedBytes{0};
+    std::atomic<size_t> _retainedBytes{0};
+    std::atomic<size_t> _maxRetainedBytes{size_t{256} << 20};
+};
+
 class Buffer {
 public:
     Buffer(size_t size) : _size(size), _data(new int[size]) {
         std::cout << "Buffer constructed (regular)." << std::endl;
     }
+    // Storage comes from (and returns to) BufferPool.
+    static Buffer fromPool(size_t size) {
+        size_t capacity = 0;
+        int* data = BufferPool::instance().acquire(size, capacity);
+        return Buffer(data, size, capacity);
+    }
     // Move constructor
-    Buffer(Buffer&& other) noexcept : _size(other._size), _data(other._data) {
+    Buffer(Buffer&& other) noexcept : _size(other._size), _data(other._data), _capacity(other._capacity) {
         std::cout << "Buffer move-constructed." << std::endl;
         other._size = 0;
         other._data = nullptr;
+        other._capacity = 0;
     }
-    ~Buffer() { delete[] _data; }
+    // Move assignment
+    Buffer& operator=(Buffer&& other) noexcept {
+        if (this != &other) {
+            freeStorage();
+            _size = other._size;
+            _data = other._data;
+            _capacity = other._capacity;
+            other._size = 0;
+            other._data = nullptr;
+            other._capacity = 0;
+        }
+        return *this;
+    }
+    ~Buffer() { freeStorage(); }
+    int* data() { return _data; }
+    size_t size() const { return _size; }
 private:
+    Buffer(int* data, size_t size, size_t capacity) : _size(size), _data(data), _capacity(capacity) {}
+
+    void freeStorage() {
+        if (_capacity != 0) {
+            BufferPool::instance().release(_data, _capacity);
+        } else {
+            delete[] _data;
+        }
+    }
+
     size_t _size;
     int* _data;
+    size_t _capacity = 0;  // non-zero when the storage belongs to BufferPool
 };
 
 void moveSemanticsExample() {
@@ -84,6 +251,56 @@ void moveSemanticsExample() {
     Buffer b2 = std::move(b1); // Efficiently "steals" the resource from b1
 }
 
+// Simulated I/O path: every request takes a 40 MB buffer, fills it and reads
+// it back. That is above glibc's largest mmap threshold (32 MB), so each
+// new int[] maps fresh pages and page-faults on first touch.
+long long handleRequests(int requests, bool pooled) {
+    const size_t size = 10 * 1024 * 1024;
+    long long checksum = 0;
+    for (int r = 0; r < requests; ++r) {
+        if (pooled) {
+            Buffer buffer = Buffer::fromPool(size);
+            std::fill(buffer.data(), buffer.data() + size, r);
+            checksum += std::accumulate(buffer.data(), buffer.data() + size, 0LL);
+        } else {
+            std::unique_ptr<int[]> buffer(new int[size]);
+            std::fill(buffer.get(), buffer.get() + size, r);
+            checksum += std::accumulate(buffer.get(), buffer.get() + size, 0LL);
+        }
+    }
+    return checksum;
+}
+
+void bufferPoolExample() {
+    std::cout << "\n--- C++11: Recycling Buffer Pool ---" << std::endl;
+    const int requests = 20, threads = 2;
+    for (bool pooled : {false, true}) {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> workers;
+        std::vector<long long> checksums(threads);
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] { checksums[t] = handleRequests(requests, pooled); });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+        std::cout << (pooled ? "pooled Buffer: " : "new int[] per request: ") << elapsed.count() << " ms for "
+                  << threads * requests << " requests (checksum " << checksums[0] + checksums[1] << ")" << std::endl;
+    }
+
+    BufferPool& pool = BufferPool::instance();
+    {
+        Buffer a = Buffer::fromPool(100000), b = Buffer::fromPool(100000);
+    }
+    BufferPool::Stats stats = pool.stats();
+    std::cout << "hit rate " << stats.hitRate() * 100 << "%, retained " << stats.retainedBytes << " bytes" << std::endl;
+    pool.trim();  // starts a new window: both cached blocks were used since the last trim
+    pool.trim();  // nothing was taken in this window, so the idle blocks are freed
+    stats = pool.stats();
+    std::cout << "after trimming: retained " << stats.retainedBytes << " bytes, trimmed " << stats.trimmedBytes << " bytes" << std::endl;
+}
+
 // C++14 Features
 
 // 1. Generic Lambdas
@@ -123,6 +340,7 @@ int main() {
     lambdaExample();
     smartPointerExample();
     moveSemanticsExample();
+    bufferPoolExample();
 
     // C++14
     genericLambdaExample();
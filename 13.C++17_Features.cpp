@@ -5,6 +5,18 @@
 #include <optional>
 #include <any>
 #include <string_view>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <random>
+
+// The SIMD kernels below use AVX2 when the compiler targets it
+// (e.g. g++ -std=c++17 -O2 -mavx2 13.C++17_Features.cpp) and plain loops otherwise.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 // --- Key Features of C++17 ---
 
@@ -35,13 +47,184 @@ void ifWithInitializerExample() {
     // 'it' is not accessible here
 }
 
+
+// --- SIMD search kernels ---
+// find, count, find-any-of and min/max index over int8..int64, float and double.
+// Each AVX2 step compares 32 bytes at once and turns the result into a bit mask
+// with movemask; the position of the first set bit gives the element index.
+// Results are std::optional<size_t> indices, std::nullopt when nothing matches.
+// For min/max, NaNs are not supported.
+namespace simd {
+
+#if defined(__AVX2__)
+template <typename T>
+__m256i broadcast(T v) {
+    if constexpr (std::is_same_v<T, float>) return _mm256_castps_si256(_mm256_set1_ps(v));
+    else if constexpr (std::is_same_v<T, double>) return _mm256_castpd_si256(_mm256_set1_pd(v));
+    else if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(static_cast<char>(v));
+    else if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<short>(v));
+    else if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int>(v));
+    else return _mm256_set1_epi64x(static_cast<long long>(v));
+}
+
+template <typename T>
+__m256i load(const T* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+// Lanes equal to b are all ones.
+template <typename T>
+__m256i equal(__m256i a, __m256i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm256_cmpeq_epi8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_cmpeq_epi16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_cmpeq_epi32(a, b);
+    } else {
+        return _mm256_cmpeq_epi64(a, b);
+    }
+}
+
+template <typename T, bool Max>
+__m256i minOrMax(__m256i a, __m256i b) {
+    if constexpr (std::is_same_v<T, float>) {
+        __m256 x = _mm256_castsi256_ps(a), y = _mm256_castsi256_ps(b);
+        return _mm256_castps_si256(Max ? _mm256_max_ps(x, y) : _mm256_min_ps(x, y));
+    } else if constexpr (std::is_same_v<T, double>) {
+        __m256d x = _mm256_castsi256_pd(a), y = _mm256_castsi256_pd(b);
+        return _mm256_castpd_si256(Max ? _mm256_max_pd(x, y) : _mm256_min_pd(x, y));
+    } else if constexpr (sizeof(T) == 1) {
+        if constexpr (std::is_signed_v<T>) return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+        else return Max ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+    } else if constexpr (sizeof(T) == 2) {
+        if constexpr (std::is_signed_v<T>) return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+        else return Max ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b);
+    } else if constexpr (sizeof(T) == 4) {
+        if constexpr (std::is_signed_v<T>) return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+        else return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+    } else {
+        // There is no 64-bit unsigned compare: flipping the sign bit maps
+        // unsigned order onto signed order.
+        __m256i x = a, y = b;
+        if constexpr (!std::is_signed_v<T>) {
+            __m256i signBit = _mm256_set1_epi64x(INT64_MIN);
+            x = _mm256_xor_si256(a, signBit);
+            y = _mm256_xor_si256(b, signBit);
+        }
+        __m256i aGreater = _mm256_cmpgt_epi64(x, y);
+        return Max ? _mm256_blendv_epi8(b, a, aGreater) : _mm256_blendv_epi8(a, b, aGreater);
+    }
+}
+
+// One bit per byte; each matching element sets sizeof(T) consecutive bits.
+inline uint32_t byteMask(__m256i v) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+}
+#endif
+
+template <typename T>
+std::optional<size_t> find(const T* data, size_t n, T value) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    constexpr size_t kLanes = 32 / sizeof(T);
+    __m256i needle = broadcast(value);
+    for (; i + kLanes <= n; i += kLanes) {
+        if (uint32_t mask = byteMask(equal<T>(load(data + i), needle))) {
+            return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T);
+        }
+    }
+#endif
+    const T* it = std::find(data + i, data + n, value);
+    if (it != data + n) return static_cast<size_t>(it - data);
+    return std::nullopt;
+}
+
+template <typename T>
+size_t count(const T* data, size_t n, T value) {
+    size_t total = 0, i = 0;
+#if defined(__AVX2__)
+    constexpr size_t kLanes = 32 / sizeof(T);
+    __m256i needle = broadcast(value);
+    for (; i + kLanes <= n; i += kLanes) {
+        total += static_cast<size_t>(__builtin_popcount(byteMask(equal<T>(load(data + i), needle)))) / sizeof(T);
+    }
+#endif
+    return total + static_cast<size_t>(std::count(data + i, data + n, value));
+}
+
+// First index whose element equals any value in set (meant for small sets).
+template <typename T>
+std::optional<size_t> findAnyOf(const T* data, size_t n, const T* set, size_t setSize) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    constexpr size_t kLanes = 32 / sizeof(T);
+    constexpr size_t kMaxVectorSet = 16;
+    if (setSize <= kMaxVectorSet) {
+        __m256i needles[kMaxVectorSet];
+        for (size_t s = 0; s < setSize; ++s) needles[s] = broadcast(set[s]);
+        for (; i + kLanes <= n; i += kLanes) {
+            __m256i block = load(data + i);
+            __m256i hits = _mm256_setzero_si256();
+            for (size_t s = 0; s < setSize; ++s) hits = _mm256_or_si256(hits, equal<T>(block, needles[s]));
+            if (uint32_t mask = byteMask(hits)) {
+                return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T);
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (std::find(set, set + setSize, data[i]) != set + setSize) return i;
+    }
+    return std::nullopt;
+}
+
+// Index of the first minimum (Max = false) or maximum (Max = true): one pass
+// computes the extreme value lane-wise, a second pass finds where it occurs.
+template <bool Max, typename T>
+std::optional<size_t> extremeIndex(const T* data, size_t n) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8,
+                  "min/max kernels take integer or floating-point types of up to 64 bits");
+    if (n == 0) return std::nullopt;
+    T best = data[0];
+    size_t i = 0;
+#if defined(__AVX2__)
+    constexpr size_t kLanes = 32 / sizeof(T);
+    if (n >= kLanes) {
+        __m256i acc = load(data);
+        for (i = kLanes; i + kLanes <= n; i += kLanes) {
+            acc = minOrMax<T, Max>(acc, load(data + i));
+        }
+        alignas(32) T lanes[kLanes];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (T v : lanes) best = Max ? std::max(best, v) : std::min(best, v);
+    }
+#endif
+    for (; i < n; ++i) best = Max ? std::max(best, data[i]) : std::min(best, data[i]);
+    return find(data, n, best);
+}
+
+template <typename T>
+std::optional<size_t> minIndex(const T* data, size_t n) { return extremeIndex<false>(data, n); }
+template <typename T>
+std::optional<size_t> maxIndex(const T* data, size_t n) { return extremeIndex<true>(data, n); }
+
+template <typename T>
+std::optional<size_t> find(const std::vector<T>& v, T value) { return find(v.data(), v.size(), value); }
+template <typename T>
+size_t count(const std::vector<T>& v, T value) { return count(v.data(), v.size(), value); }
+
+} // namespace simd
+
 // 3. std::optional
 // Represents a value that may or may not be present. Avoids using special values like -1 or nullptr.
 std::optional<int> findValue(const std::vector<int>& data, int value_to_find) {
-    for (int val : data) {
-        if (val == value_to_find) {
-            return val; // Value found, return it
-        }
+    if (simd::find(data, value_to_find)) {
+        return value_to_find; // Value found, return it
     }
     return std::nullopt; // Value not found
 }
@@ -97,10 +280,46 @@ void stdStringViewExample() {
     printString(fox_view);
 }
 
+void simdSearchExample() {
+    std::cout << "\n--- SIMD search kernels ---" << std::endl;
+#if defined(__AVX2__)
+    std::cout << "Using AVX2" << std::endl;
+#else
+    std::cout << "Using the scalar fallback (compile with -mavx2 for AVX2)" << std::endl;
+#endif
+    std::vector<int16_t> ids = {7, 3, 9, 3, 12, -4, 3, 8, 15, 21, 2, 3, 40, 5, 6, 11, 1, 30};
+    const int16_t wanted[] = {40, 21};
+    std::cout << "count(3) = " << simd::count(ids, int16_t{3})
+              << ", findAnyOf{40, 21} at " << simd::findAnyOf(ids.data(), ids.size(), wanted, 2).value_or(SIZE_MAX)
+              << ", min at " << simd::minIndex(ids.data(), ids.size()).value_or(SIZE_MAX)
+              << ", max at " << simd::maxIndex(ids.data(), ids.size()).value_or(SIZE_MAX) << std::endl;
+
+    std::vector<double> prices = {3.5, 1.25, 9.75, 1.25, 4.0};
+    std::cout << "cheapest price at index " << simd::minIndex(prices.data(), prices.size()).value_or(SIZE_MAX) << std::endl;
+
+    // Benchmark: many short scans over ID lists, as in an inner loop.
+    std::mt19937 rng(1);
+    std::vector<int32_t> list(64);
+    for (auto& v : list) v = static_cast<int32_t>(rng() % 1000);
+    std::vector<int32_t> probes(4000000);
+    for (auto& p : probes) p = static_cast<int32_t>(rng() % 1000);
+
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t p : probes) found += std::find(list.begin(), list.end(), p) != list.end();
+    auto stdTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    for (int32_t p : probes) found += simd::find(list, p).has_value();
+    auto simdTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << probes.size() << " scans of 64 ints: std::find " << stdTime.count() << " ms, simd::find "
+              << simdTime.count() << " ms (" << found << " hits)" << std::endl;
+}
+
 int main() {
     structuredBindingsExample();
     ifWithInitializerExample();
     stdOptionalExample();
+    simdSearchExample();
     stdAnyExample();
     stdStringViewExample();
 
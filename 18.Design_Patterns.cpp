@@ -1,9 +1,24 @@
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+#include <mutex>
+#include <shared_mutex>
+#include <cstring>
+#include <new>
+#include <array>
+#include <cassert>
 
 // --- Creational Patterns ---
 
@@ -72,6 +87,147 @@ public:
 };
 
 
+// 2b. Pooled Factory Method
+// Same create-use-destroy shape as Creator, but products are recycled instead of
+// deleted. Each thread keeps its own free list per product type, so acquire and
+// release never synchronize. Handles are unique_ptrs whose deleter puts the
+// object back; a product with a Reset() member has it called on the way back.
+// Hit/miss counts live in the free lists too; only HitRate() takes a lock to
+// sum them.
+template <typename Base>
+struct PoolDeleter {
+    void (*recycle)(Base*) = nullptr;
+    void operator()(Base* p) const { recycle(p); }
+};
+
+template <typename Base>
+using PoolHandle = std::unique_ptr<Base, PoolDeleter<Base>>;
+
+template <typename T, typename = void>
+struct HasReset : std::false_type {};
+template <typename T>
+struct HasReset<T, std::void_t<decltype(std::declval<T&>().Reset())>> : std::true_type {};
+
+template <typename T>
+class ObjectPool {
+public:
+    static constexpr size_t kMaxCachedPerThread = 1024;
+
+    template <typename Base = T>
+    static PoolHandle<Base> Acquire() {
+        FreeList& list = freeList();
+        T* obj;
+        if (!list.objects.empty()) {
+            obj = list.objects.back();
+            list.objects.pop_back();
+            list.Count(list.hits);
+        } else {
+            obj = new T();
+            list.Count(list.misses);
+        }
+        return PoolHandle<Base>(obj, PoolDeleter<Base>{&Release<Base>});
+    }
+
+    static double HitRate() {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        uint64_t hits = exitedHits_, misses = exitedMisses_;
+        for (const FreeList* list : lists_) {
+            hits += list->hits.load(std::memory_order_relaxed);
+            misses += list->misses.load(std::memory_order_relaxed);
+        }
+        uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+
+private:
+    // Registered for HitRate(); a thread's counts are folded into the
+    // exited totals when its list is destroyed.
+    struct FreeList {
+        std::vector<T*> objects;
+        // Written only by the owning thread, so a relaxed load and store
+        // suffice (no locked read-modify-write); atomic only so HitRate()
+        // can read them.
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+
+        FreeList() {
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            lists_.push_back(this);
+        }
+        ~FreeList() {
+            for (T* obj : objects) delete obj;
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            exitedHits_ += hits.load(std::memory_order_relaxed);
+            exitedMisses_ += misses.load(std::memory_order_relaxed);
+            lists_.erase(std::find(lists_.begin(), lists_.end(), this));
+        }
+
+        static void Count(std::atomic<uint64_t>& counter) {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    static FreeList& freeList() {
+        thread_local FreeList list;
+        return list;
+    }
+
+    template <typename Base>
+    static void Release(Base* p) {
+        T* obj = static_cast<T*>(p);
+        if constexpr (HasReset<T>::value) {
+            obj->Reset();
+        }
+        FreeList& list = freeList();
+        if (list.objects.size() < kMaxCachedPerThread) {
+            list.objects.push_back(obj);
+        } else {
+            delete obj;
+        }
+    }
+
+    static inline std::mutex statsMutex_;
+    static inline std::vector<const FreeList*> lists_;
+    static inline uint64_t exitedHits_ = 0;
+    static inline uint64_t exitedMisses_ = 0;
+};
+
+class PooledCreator {
+public:
+    virtual ~PooledCreator(){};
+    virtual PoolHandle<Product> FactoryMethod() const = 0;
+
+    std::string SomeOperation() const {
+        PoolHandle<Product> product = this->FactoryMethod();
+        return "PooledCreator: The same creator's code has just worked with " + product->Operation();
+    }
+};
+
+class PooledCreatorA : public PooledCreator {
+public:
+    PoolHandle<Product> FactoryMethod() const override {
+        return ObjectPool<ConcreteProductA>::Acquire<Product>();
+    }
+};
+
+class PooledCreatorB : public PooledCreator {
+public:
+    PoolHandle<Product> FactoryMethod() const override {
+        return ObjectPool<ConcreteProductB>::Acquire<Product>();
+    }
+};
+
+// A product with per-use state; Reset() clears it but keeps the string's capacity.
+class RequestProduct : public Product {
+public:
+    std::string payload;
+    std::string Operation() const override {
+        return "{Request of " + std::to_string(payload.size()) + " bytes}";
+    }
+    void Reset() { payload.clear(); }
+};
+
+
 // 3. Builder
 class Car {
 public:
@@ -113,10 +269,45 @@ public:
         builder->buildBody();
         builder->buildSeats();
     }
+    // Same steps for builders that don't derive from CarBuilder, resolved at compile time.
+    template <typename Builder>
+    static void construct(Builder& b) {
+        b.buildEngine();
+        b.buildBody();
+        b.buildSeats();
+    }
 private:
     CarBuilder* builder;
 };
 
+// 3b. In-place Builder
+// The builder writes the Car either into its own by-value member or directly
+// into caller-owned storage, so building costs no heap round-trip for the
+// product. build() moves the finished Car out of the builder's own storage.
+// When building into caller storage the steps assign into the existing
+// strings, so repeated builds reuse the same capacity.
+class InPlaceSportsCarBuilder {
+private:
+    Car own_{};
+    Car* car_;
+public:
+    InPlaceSportsCarBuilder() : car_(&own_) {}
+    explicit InPlaceSportsCarBuilder(Car& target) : car_(&target) {}
+    InPlaceSportsCarBuilder(const InPlaceSportsCarBuilder&) = delete;
+    InPlaceSportsCarBuilder& operator=(const InPlaceSportsCarBuilder&) = delete;
+
+    void buildEngine() { car_->engine.assign("Sports Engine"); }
+    void buildBody() { car_->body.assign("Sports Body"); }
+    void buildSeats() { car_->seats = 2; }
+
+    // Only meaningful for the builder's own storage; the builder is ready for the next build afterwards.
+    Car build() {
+        Car out = std::move(own_);
+        own_ = Car{};
+        return out;
+    }
+};
+
 // 4. Prototype
 class Prototype {
 public:
@@ -135,6 +326,101 @@ public:
     }
 };
 
+// 4b. Copy-on-write Prototype
+// clone() shares the prototype's state instead of copying it; the first call to
+// mutate() on a clone that still shares makes the private copy. State blocks
+// (shared_ptr control block included, via allocate_shared) come from a
+// per-thread free list, so the copies that do happen skip the general heap.
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+    static constexpr size_t kMaxCachedPerThread = 4096;
+
+    PoolAllocator() noexcept {}
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        FreeList& list = freeList();
+        if (n == 1 && !list.blocks.empty()) {
+            void* block = list.blocks.back();
+            list.blocks.pop_back();
+            return static_cast<T*>(block);
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        FreeList& list = freeList();
+        if (n == 1 && list.blocks.size() < kMaxCachedPerThread) {
+            list.blocks.push_back(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+private:
+    struct FreeList {
+        std::vector<void*> blocks;
+        ~FreeList() {
+            for (void* block : blocks) ::operator delete(block);
+        }
+    };
+
+    static FreeList& freeList() {
+        thread_local FreeList list;
+        return list;
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) { return false; }
+
+template <typename State>
+class CowPrototype {
+public:
+    explicit CowPrototype(State state)
+        : state_(std::allocate_shared<State>(PoolAllocator<State>(), std::move(state))) {}
+
+    CowPrototype clone() const { return *this; }
+    const State& get() const { return *state_; }
+
+    State& mutate() {
+        if (state_.use_count() != 1) {
+            state_ = std::allocate_shared<State>(PoolAllocator<State>(), *state_);
+        }
+        return *state_;
+    }
+
+    bool sharesStateWith(const CowPrototype& other) const { return state_ == other.state_; }
+
+private:
+    std::shared_ptr<State> state_;
+};
+
+template <typename State>
+class PrototypeRegistry {
+public:
+    void add(const std::string& name, State state) {
+        prototypes_.insert_or_assign(name, CowPrototype<State>(std::move(state)));
+    }
+    // Throws std::out_of_range for an unknown name.
+    CowPrototype<State> clone(const std::string& name) const {
+        return prototypes_.at(name).clone();
+    }
+private:
+    std::unordered_map<std::string, CowPrototype<State>> prototypes_;
+};
+
+struct SessionConfig {
+    std::map<std::string, std::string> settings;
+    std::vector<std::string> routes;
+    int timeoutMs = 30000;
+};
+
 // --- Structural Patterns ---
 
 // 5. Adapter
@@ -166,16 +452,40 @@ public:
 };
 
 // 6. Decorator
+// Operation() builds the result for a whole chain in one buffer: the chain is
+// first asked for the final length, then every level appends its own part to
+// the same string. Callers that handle many requests can pass their own buffer
+// to AppendOperation() and reuse it, avoiding allocation entirely.
 class Component {
  public:
   virtual ~Component() {}
   virtual std::string Operation() const = 0;
+  virtual void AppendOperation(std::string &out) const {
+    out += Operation();
+  }
+  virtual size_t OperationLength() const {
+    return Operation().size();
+  }
+  std::string BufferedOperation() const {
+    std::string out;
+    out.reserve(OperationLength());
+    AppendOperation(out);
+    return out;
+  }
 };
 
 class ConcreteComponent : public Component {
+  static constexpr std::string_view kName = "ConcreteComponent";
+
  public:
   std::string Operation() const override {
-    return "ConcreteComponent";
+    return std::string(kName);
+  }
+  void AppendOperation(std::string &out) const override {
+    out += kName;
+  }
+  size_t OperationLength() const override {
+    return kName.size();
   }
 };
 
@@ -189,15 +499,195 @@ class Decorator : public Component {
   std::string Operation() const override {
     return this->component_->Operation();
   }
+  void AppendOperation(std::string &out) const override {
+    this->component_->AppendOperation(out);
+  }
+  size_t OperationLength() const override {
+    return this->component_->OperationLength();
+  }
 };
 
 class ConcreteDecoratorA : public Decorator {
+  static constexpr std::string_view kPrefix = "ConcreteDecoratorA(";
+
  public:
   ConcreteDecoratorA(Component* component) : Decorator(component) {
   }
   std::string Operation() const override {
-    return "ConcreteDecoratorA(" + Decorator::Operation() + ")";
+    return BufferedOperation();
+  }
+  void AppendOperation(std::string &out) const override {
+    out += kPrefix;
+    Decorator::AppendOperation(out);
+    out += ')';
   }
+  size_t OperationLength() const override {
+    return kPrefix.size() + Decorator::OperationLength() + 1;
+  }
+};
+
+// 6b. Flyweight (string interning)
+// Repeated strings such as engine names are stored once and referred to by a
+// 32-bit Symbol, which compares and hashes as an integer. The bytes live in
+// per-shard arena chunks, the id -> string table is split into segments that
+// never move, and lookups only take a shared lock on one of 16 shards.
+struct Symbol {
+    uint32_t id = 0; // 0 is always the empty string
+    bool operator==(Symbol other) const { return id == other.id; }
+    bool operator!=(Symbol other) const { return id != other.id; }
+};
+
+namespace std {
+template <>
+struct hash<Symbol> {
+    size_t operator()(Symbol s) const noexcept { return s.id; }
+};
+}
+
+class StringInterner {
+public:
+    StringInterner() { Intern(""); }
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    ~StringInterner() {
+        for (auto& segment : segments_) delete[] segment.load(std::memory_order_relaxed);
+    }
+
+    Symbol Intern(std::string_view str) {
+        size_t hash = std::hash<std::string_view>{}(str);
+        Shard& shard = shards_[hash % kNumShards];
+        uint32_t tag = static_cast<uint32_t>(hash >> 32);
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            if (uint32_t id = Find(shard, str, tag); id != kNotFound) return Symbol{id};
+        }
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (uint32_t id = Find(shard, str, tag); id != kNotFound) return Symbol{id};
+
+        uint32_t id = nextId_.fetch_add(1, std::memory_order_relaxed);
+        Entry& entry = EntryFor(id);
+        entry.data = shard.arena.Copy(str);
+        entry.size = static_cast<uint32_t>(str.size());
+        if ((shard.count + 1) * 4 > shard.slots.size() * 3) Grow(shard);
+        Insert(shard, tag, id);
+        ++shard.count;
+        return Symbol{id};
+    }
+
+    // Valid for the lifetime of the interner.
+    std::string_view View(Symbol s) const {
+        const Entry& entry = EntryFor(s.id);
+        return {entry.data, entry.size};
+    }
+
+    size_t Size() const { return nextId_.load(std::memory_order_relaxed); }
+    size_t ArenaBytes() const {
+        size_t total = 0;
+        for (const Shard& shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            total += shard.arena.bytes;
+        }
+        return total;
+    }
+
+private:
+    static constexpr size_t kNumShards = 16;
+    static constexpr uint32_t kNotFound = ~0u;
+    static constexpr unsigned kFirstSegmentBits = 10;
+    static constexpr unsigned kNumSegments = 22;
+
+    struct Entry {
+        const char* data;
+        uint32_t size;
+    };
+
+    struct Arena {
+        static constexpr size_t kChunkSize = 64 * 1024;
+        std::vector<std::unique_ptr<char[]>> chunks;
+        std::vector<std::unique_ptr<char[]>> largeBlocks;  // one per string over kChunkSize / 4
+        char* open = nullptr;                              // free space in the newest chunk
+        size_t remaining = 0;
+        size_t bytes = 0;
+
+        const char* Copy(std::string_view str) {
+            if (str.size() > kChunkSize / 4) {
+                largeBlocks.push_back(std::make_unique<char[]>(str.size()));
+                char* dst = largeBlocks.back().get();
+                std::memcpy(dst, str.data(), str.size());
+                bytes += str.size();
+                return dst;
+            }
+            if (!open || str.size() > remaining) {
+                chunks.push_back(std::make_unique<char[]>(kChunkSize));
+                open = chunks.back().get();
+                remaining = kChunkSize;
+                bytes += kChunkSize;
+            }
+            char* dst = open;
+            std::memcpy(dst, str.data(), str.size());
+            open += str.size();
+            remaining -= str.size();
+            return dst;
+        }
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::vector<uint64_t> slots = std::vector<uint64_t>(64, 0); // (tag << 32) | (id + 1), 0 = empty
+        size_t count = 0;
+        Arena arena;
+    };
+
+    // Segment k holds 1024 << k entries, so id -> (segment, offset) is a bit scan
+    // and existing entries never move when the table grows.
+    Entry& EntryFor(uint32_t id) const {
+        uint64_t i = static_cast<uint64_t>(id) + (1u << kFirstSegmentBits);
+        unsigned top = 63 - static_cast<unsigned>(__builtin_clzll(i));
+        unsigned k = top - kFirstSegmentBits;
+        uint64_t offset = i - (uint64_t{1} << top);
+        Entry* segment = segments_[k].load(std::memory_order_acquire);
+        if (!segment) {
+            Entry* fresh = new Entry[size_t{1} << top]();
+            if (segments_[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel)) {
+                segment = fresh;
+            } else {
+                delete[] fresh;
+            }
+        }
+        return segment[offset];
+    }
+
+    uint32_t Find(const Shard& shard, std::string_view str, uint32_t tag) const {
+        size_t mask = shard.slots.size() - 1;
+        for (size_t pos = tag & mask;; pos = (pos + 1) & mask) {
+            uint64_t slot = shard.slots[pos];
+            if (slot == 0) return kNotFound;
+            if (static_cast<uint32_t>(slot >> 32) == tag) {
+                uint32_t id = static_cast<uint32_t>(slot) - 1;
+                if (View(Symbol{id}) == str) return id;
+            }
+        }
+    }
+
+    static void Insert(Shard& shard, uint32_t tag, uint32_t id) {
+        size_t mask = shard.slots.size() - 1;
+        size_t pos = tag & mask;
+        while (shard.slots[pos] != 0) pos = (pos + 1) & mask;
+        shard.slots[pos] = (static_cast<uint64_t>(tag) << 32) | (id + 1);
+    }
+
+    static void Grow(Shard& shard) {
+        std::vector<uint64_t> old(shard.slots.size() * 2, 0);
+        old.swap(shard.slots);
+        for (uint64_t slot : old) {
+            if (slot != 0) Insert(shard, static_cast<uint32_t>(slot >> 32), static_cast<uint32_t>(slot) - 1);
+        }
+    }
+
+    Shard shards_[kNumShards];
+    mutable std::atomic<Entry*> segments_[kNumSegments] = {};
+    std::atomic<uint32_t> nextId_{0};
 };
 
 // --- Behavioral Patterns ---
@@ -240,6 +730,98 @@ public:
     }
 };
 
+// 7b. Static-dispatch Strategy
+// When the set of strategies is known, the indirection can be resolved earlier:
+// StaticContext<S> fixes the strategy at compile time (fully inlinable), while
+// VariantContext picks one of a closed set at run time through std::visit.
+// Both share the CRTP interface below, and doAlgorithm writes into a caller-owned
+// string instead of returning a fresh one.
+template <typename Derived>
+class StrategyBase {
+public:
+    void doAlgorithm(const std::vector<std::string> &data, std::string &result) const {
+        static_cast<const Derived &>(*this).doAlgorithmImpl(data, result);
+    }
+    double onTick(double price) const {
+        return static_cast<const Derived &>(*this).onTickImpl(price);
+    }
+};
+
+class SortAscending : public StrategyBase<SortAscending> {
+public:
+    void doAlgorithmImpl(const std::vector<std::string> &data, std::string &result) const {
+        result.clear();
+        for (const std::string &letter : data) result += letter;
+        std::sort(result.begin(), result.end());
+    }
+    double onTickImpl(double price) const { return price * 1.0005; }
+};
+
+class SortDescending : public StrategyBase<SortDescending> {
+public:
+    void doAlgorithmImpl(const std::vector<std::string> &data, std::string &result) const {
+        result.clear();
+        for (const std::string &letter : data) result += letter;
+        std::sort(result.begin(), result.end(), std::greater<char>());
+    }
+    double onTickImpl(double price) const { return price + 0.01; }
+};
+
+template <typename S>
+class StaticContext {
+private:
+    S strategy_;
+    mutable std::string result_;
+public:
+    const std::string &doSomeBusinessLogic(const std::vector<std::string> &data) const {
+        strategy_.doAlgorithm(data, result_);
+        return result_;
+    }
+    double onTick(double price) const { return strategy_.onTick(price); }
+};
+
+class VariantContext {
+public:
+    using StrategyVariant = std::variant<SortAscending, SortDescending>;
+private:
+    StrategyVariant strategy_;
+    mutable std::string result_;
+public:
+    explicit VariantContext(StrategyVariant strategy = SortAscending{}) : strategy_(strategy) {}
+    void set_strategy(StrategyVariant strategy) { strategy_ = strategy; }
+    const std::string &doSomeBusinessLogic(const std::vector<std::string> &data) const {
+        std::visit([&](const auto &s) { s.doAlgorithm(data, result_); }, strategy_);
+        return result_;
+    }
+    double onTick(double price) const {
+        return std::visit([price](const auto &s) { return s.onTick(price); }, strategy_);
+    }
+};
+
+// Virtual baseline for the benchmark, wrapping the same strategies.
+class TickStrategy {
+public:
+    virtual ~TickStrategy() {}
+    virtual double onTick(double price) const = 0;
+};
+
+template <typename S>
+class VirtualTickStrategy : public TickStrategy {
+private:
+    S strategy_;
+public:
+    double onTick(double price) const override { return strategy_.onTick(price); }
+};
+
+template <typename Fn>
+void benchmarkDispatch(const char *label, const std::vector<double> &ticks, Fn onTick) {
+    auto start = std::chrono::steady_clock::now();
+    double total = 0.0;
+    for (double price : ticks) total += onTick(price);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << label << elapsed.count() << " us (checksum " << total << ")\n";
+}
+
 // 8. Observer
 class IObserver {
  public:
@@ -315,6 +897,350 @@ class Observer : public IObserver {
 
 int Observer::static_number_ = 0;
 
+// 9. Event Bus (lock-free, batched Observer)
+// Publishers on any thread push into a bounded lock-free queue per topic; a
+// single dispatcher thread drains each queue and hands every subscriber the
+// whole batch by const reference, so a message is never copied per subscriber.
+// Subscriber lists are immutable snapshots swapped atomically (RCU style):
+// subscribe/unsubscribe copy the list, the dispatcher just loads the current one.
+template <typename T>
+class MpscRing {
+public:
+    explicit MpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Safe from any number of threads; returns false when the ring is full.
+    bool tryPush(T value) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Single consumer only.
+    bool tryPop(T &out) {
+        Cell &cell = cells_[dequeuePos_ & mask_];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (seq != dequeuePos_ + 1) return false;
+        out = std::move(cell.value);
+        cell.seq.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T value;
+    };
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) size_t dequeuePos_ = 0;
+};
+
+template <typename Message>
+class EventBus {
+public:
+    using Batch = std::vector<Message>;
+    using Handler = std::function<void(const Batch &)>;
+    using SubscriptionId = size_t;
+
+    EventBus(size_t numTopics, size_t queueCapacity = 4096) {
+        for (size_t i = 0; i < numTopics; ++i) {
+            topics_.push_back(std::make_unique<Topic>(queueCapacity));
+        }
+    }
+
+    // Lock-free; returns false if the topic's queue is full (caller decides to retry or drop).
+    bool Publish(size_t topic, Message message) {
+        return topics_[topic]->queue.tryPush(std::move(message));
+    }
+
+    SubscriptionId Subscribe(size_t topic, Handler handler) {
+        SubscriptionId id = nextId_.fetch_add(1, std::memory_order_relaxed);
+        Topic &t = *topics_[topic];
+        UpdateSubscribers(t, [&](SubscriberList &list) { list.push_back({id, std::move(handler)}); });
+        return id;
+    }
+
+    void Unsubscribe(size_t topic, SubscriptionId id) {
+        Topic &t = *topics_[topic];
+        UpdateSubscribers(t, [&](SubscriberList &list) {
+            list.erase(std::remove_if(list.begin(), list.end(), [id](const Subscriber &s) { return s.id == id; }), list.end());
+        });
+    }
+
+    // Drains up to maxBatch messages per topic and delivers them. Call from one thread only.
+    // Returns the number of messages delivered.
+    size_t Dispatch(size_t maxBatch = 256) {
+        size_t delivered = 0;
+        for (auto &topic : topics_) {
+            Batch &batch = topic->batch;
+            batch.clear();
+            Message message;
+            while (batch.size() < maxBatch && topic->queue.tryPop(message)) {
+                batch.push_back(std::move(message));
+            }
+            if (batch.empty()) continue;
+            std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&topic->subscribers);
+            for (const Subscriber &s : *subscribers) {
+                s.handler(batch);
+            }
+            delivered += batch.size();
+            ++batches_;
+        }
+        return delivered;
+    }
+
+    size_t BatchCount() const { return batches_; }
+
+private:
+    struct Subscriber {
+        SubscriptionId id;
+        Handler handler;
+    };
+    using SubscriberList = std::vector<Subscriber>;
+
+    struct Topic {
+        explicit Topic(size_t capacity) : queue(capacity), subscribers(std::make_shared<const SubscriberList>()) {}
+        MpscRing<Message> queue;
+        std::shared_ptr<const SubscriberList> subscribers;
+        Batch batch;
+    };
+
+    template <typename Fn>
+    void UpdateSubscribers(Topic &topic, Fn modify) {
+        std::shared_ptr<const SubscriberList> current = std::atomic_load(&topic.subscribers);
+        for (;;) {
+            auto next = std::make_shared<SubscriberList>(*current);
+            modify(*next);
+            std::shared_ptr<const SubscriberList> desired = std::move(next);
+            if (std::atomic_compare_exchange_weak(&topic.subscribers, &current, desired)) return;
+        }
+    }
+
+    std::vector<std::unique_ptr<Topic>> topics_;
+    std::atomic<SubscriptionId> nextId_{1};
+    size_t batches_ = 0;
+};
+
+
+// 10. Command (arena-backed command buffer)
+// Commands are small trivially copyable structs with Execute(receiver) and
+// Undo(receiver). They are recorded inline into one contiguous buffer behind a
+// 16-byte header holding a pointer to the per-type function table, so recording
+// never allocates per command and a batch executes by walking the buffer.
+// Each header also stores the size of the previous record, which lets Undo walk
+// backwards. Undone commands can be re-executed (redo) until something new is
+// recorded; recording drops them but keeps commands that were recorded and not
+// yet executed. Replay() runs the whole log again against another receiver.
+template <typename Receiver>
+class CommandBuffer {
+public:
+    CommandBuffer() = default;
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    ~CommandBuffer() { ::operator delete(data_, std::align_val_t{kAlign}); }
+
+    template <typename C, typename... Args>
+    void Record(Args&&... args) {
+        static_assert(std::is_trivially_copyable_v<C>, "commands are relocated with memcpy");
+        static_assert(alignof(C) <= kAlign, "command alignment exceeds the buffer's");
+        // Recording after an undo discards the undone commands, as in any undo stack.
+        if (undoneEnd_ > executed_) {
+            DropUndone();
+        }
+
+        size_t recordSize = sizeof(Header) + RoundUp(sizeof(C));
+        Reserve(end_ + recordSize);
+        Header* header = reinterpret_cast<Header*>(data_ + end_);
+        header->ops = &kOps<C>;
+        header->size = static_cast<uint32_t>(recordSize);
+        header->prevSize = lastSize_;
+        new (data_ + end_ + sizeof(Header)) C{std::forward<Args>(args)...};
+        end_ += recordSize;
+        lastSize_ = header->size;
+        ++count_;
+    }
+
+    // Executes up to maxCommands pending commands in order; returns how many ran.
+    size_t ExecuteBatch(Receiver& receiver, size_t maxCommands = SIZE_MAX) {
+        size_t ran = 0;
+        while (executed_ < end_ && ran < maxCommands) {
+            Header* header = reinterpret_cast<Header*>(data_ + executed_);
+            header->ops->execute(data_ + executed_ + sizeof(Header), receiver);
+            executed_ += header->size;
+            executedLastSize_ = header->size;
+            ++executedCount_;
+            ++ran;
+        }
+        return ran;
+    }
+
+    // Undoes the last n executed commands, newest first; returns how many were undone.
+    size_t Undo(Receiver& receiver, size_t n = 1) {
+        undoneEnd_ = std::max(undoneEnd_, executed_);
+        size_t undone = 0;
+        while (executed_ > 0 && undone < n) {
+            size_t offset = executed_ - executedLastSize_;
+            Header* header = reinterpret_cast<Header*>(data_ + offset);
+            header->ops->undo(data_ + offset + sizeof(Header), receiver);
+            executed_ = offset;
+            executedLastSize_ = header->prevSize;
+            --executedCount_;
+            ++undone;
+        }
+        return undone;
+    }
+
+    // Re-executes every executed command, in order, against another receiver.
+    // Each command runs on a copy so the undo state captured in the log is kept.
+    void Replay(Receiver& receiver) const {
+        for (size_t offset = 0; offset < executed_;) {
+            const Header* header = reinterpret_cast<const Header*>(data_ + offset);
+            header->ops->replay(data_ + offset + sizeof(Header), receiver);
+            offset += header->size;
+        }
+    }
+
+    void Clear() {
+        end_ = executed_ = 0;
+        lastSize_ = executedLastSize_ = 0;
+        count_ = executedCount_ = 0;
+        undoneEnd_ = 0;
+    }
+    size_t Size() const { return count_; }
+    size_t Executed() const { return executedCount_; }
+    size_t Bytes() const { return end_; }
+
+private:
+    static constexpr size_t kAlign = 16;
+
+    struct Ops {
+        void (*execute)(unsigned char*, Receiver&);
+        void (*undo)(unsigned char*, Receiver&);
+        void (*replay)(const unsigned char*, Receiver&);
+    };
+
+    struct Header {
+        const Ops* ops;
+        uint32_t size;
+        uint32_t prevSize;
+    };
+    static_assert(sizeof(Header) == kAlign, "header keeps commands aligned");
+
+    template <typename C>
+    static inline const Ops kOps = {
+        [](unsigned char* p, Receiver& r) { std::launder(reinterpret_cast<C*>(p))->Execute(r); },
+        [](unsigned char* p, Receiver& r) { std::launder(reinterpret_cast<C*>(p))->Undo(r); },
+        [](const unsigned char* p, Receiver& r) {
+            C copy = *std::launder(reinterpret_cast<const C*>(p));
+            copy.Execute(r);
+        },
+    };
+
+    static size_t RoundUp(size_t n) { return (n + kAlign - 1) & ~(kAlign - 1); }
+
+    // Removes the undone records [executed_, undoneEnd_) and slides the pending
+    // ones down so they follow the executed prefix.
+    void DropUndone() {
+        size_t dropped = 0;
+        for (size_t offset = executed_; offset < undoneEnd_; ++dropped) {
+            offset += reinterpret_cast<const Header*>(data_ + offset)->size;
+        }
+        size_t pending = end_ - undoneEnd_;
+        std::memmove(data_ + executed_, data_ + undoneEnd_, pending);
+        if (pending > 0) {
+            reinterpret_cast<Header*>(data_ + executed_)->prevSize = executedLastSize_;
+        } else {
+            lastSize_ = executedLastSize_;
+        }
+        end_ = executed_ + pending;
+        count_ -= dropped;
+        undoneEnd_ = executed_;
+    }
+
+    void Reserve(size_t needed) {
+        if (needed <= capacity_) return;
+        size_t capacity = std::max<size_t>(capacity_ * 2, std::max<size_t>(needed, 4096));
+        auto* data = static_cast<unsigned char*>(::operator new(capacity, std::align_val_t{kAlign}));
+        if (data_) std::memcpy(data, data_, end_);
+        ::operator delete(data_, std::align_val_t{kAlign});
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    unsigned char* data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t end_ = 0;            // end of recorded commands
+    size_t executed_ = 0;       // end of the executed prefix
+    uint32_t lastSize_ = 0;
+    uint32_t executedLastSize_ = 0;
+    size_t count_ = 0;
+    size_t executedCount_ = 0;
+    size_t undoneEnd_ = 0;      // undone (redoable) commands are [executed_, undoneEnd_)
+};
+
+// Order-entry example: a receiver and two commands.
+struct OrderBook {
+    std::array<int64_t, 16> position{};
+    std::array<double, 16> limitPrice{};
+};
+
+struct AddQuantityCommand {
+    uint32_t instrument;
+    int64_t quantity;
+    void Execute(OrderBook& book) { book.position[instrument] += quantity; }
+    void Undo(OrderBook& book) { book.position[instrument] -= quantity; }
+};
+
+struct SetLimitCommand {
+    uint32_t instrument;
+    double price;
+    double previous = 0.0; // captured on Execute so Undo can restore it
+    void Execute(OrderBook& book) {
+        previous = book.limitPrice[instrument];
+        book.limitPrice[instrument] = price;
+    }
+    void Undo(OrderBook& book) { book.limitPrice[instrument] = previous; }
+};
+
+// The classic heap-allocated, virtually dispatched shape, for comparison.
+class ICommand {
+public:
+    virtual ~ICommand() {}
+    virtual void Execute(OrderBook& book) = 0;
+};
+
+class HeapAddQuantity : public ICommand {
+public:
+    HeapAddQuantity(uint32_t instrument, int64_t quantity) : command_{instrument, quantity} {}
+    void Execute(OrderBook& book) override { command_.Execute(book); }
+private:
+    AddQuantityCommand command_;
+};
+
 
 int main() {
     // Singleton
@@ -329,6 +1255,36 @@ int main() {
     delete creator1;
     std::cout << "\n";
 
+    // Pooled Factory Method
+    std::cout << "--- Pooled Factory Method ---\n";
+    PooledCreatorA pooledCreator;
+    std::cout << pooledCreator.SomeOperation() << "\n";
+    std::cout << pooledCreator.SomeOperation() << "\n";
+    {
+        const int iterations = 1000000;
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            Product* request = new RequestProduct();
+            static_cast<RequestProduct*>(request)->payload.assign(64, 'x');
+            checksum += request->Operation().size();
+            delete request;
+        }
+        auto heapTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            PoolHandle<RequestProduct> request = ObjectPool<RequestProduct>::Acquire();
+            request->payload.assign(64, 'x');
+            checksum += request->Operation().size();
+        }
+        auto poolTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << iterations << " create-use-destroy cycles: new/delete " << heapTime.count() << " ms, pool "
+                  << poolTime.count() << " ms, pool hit rate " << ObjectPool<RequestProduct>::HitRate() * 100
+                  << "% (checksum " << checksum << ")\n";
+    }
+    std::cout << "\n";
+
     // Builder
     std::cout << "--- Builder ---\n";
     Director director;
@@ -337,6 +1293,46 @@ int main() {
     director.constructCar();
     Car* car = scb.getCar();
     car->specifications();
+
+    {
+        InPlaceSportsCarBuilder builder;
+        Director::construct(builder);
+        Car built = builder.build();
+        built.specifications();
+
+        const int iterations = 2000000;
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            SportsCarBuilder heapBuilder;
+            Director d;
+            d.setBuilder(&heapBuilder);
+            d.constructCar();
+            checksum += heapBuilder.getCar()->engine.size() + static_cast<size_t>(heapBuilder.getCar()->seats);
+        }
+        auto heapTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            Director::construct(builder);
+            Car c = builder.build();
+            checksum += c.engine.size() + static_cast<size_t>(c.seats);
+        }
+        auto valueTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        Car storage{};
+        InPlaceSportsCarBuilder storageBuilder(storage);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            Director::construct(storageBuilder);
+            checksum += storage.engine.size() + static_cast<size_t>(storage.seats);
+        }
+        auto intoTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << iterations << " builds: new + virtual " << heapTime.count() << " ms, by value "
+                  << valueTime.count() << " ms, into caller storage " << intoTime.count()
+                  << " ms (checksum " << checksum << ")\n";
+    }
     std::cout << "\n";
 
     // Prototype
@@ -345,6 +1341,44 @@ int main() {
     auto clone1 = proto1->clone();
     proto1->whoAmI();
     clone1->whoAmI();
+
+    {
+        SessionConfig base;
+        for (int i = 0; i < 200; ++i) {
+            base.settings["option." + std::to_string(i)] = "value " + std::to_string(i);
+            base.routes.push_back("/api/v1/resource/" + std::to_string(i));
+        }
+        PrototypeRegistry<SessionConfig> registry;
+        registry.add("default", base);
+
+        CowPrototype<SessionConfig> session = registry.clone("default");
+        CowPrototype<SessionConfig> other = registry.clone("default");
+        std::cout << "Fresh clones share state: " << (session.sharesStateWith(other) ? "yes" : "no") << "\n";
+        session.mutate().timeoutMs = 5000;
+        std::cout << "After mutate: shares " << (session.sharesStateWith(other) ? "yes" : "no")
+                  << ", timeouts " << session.get().timeoutMs << "/" << other.get().timeoutMs << "\n";
+
+        // Session setup: every session clones the template, one in ten customizes it.
+        const int sessions = 20000;
+        size_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < sessions; ++i) {
+            auto copy = std::make_unique<SessionConfig>(base);
+            if (i % 10 == 0) copy->timeoutMs = i;
+            checksum += copy->settings.size() + static_cast<size_t>(copy->timeoutMs);
+        }
+        auto deepTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < sessions; ++i) {
+            CowPrototype<SessionConfig> copy = registry.clone("default");
+            if (i % 10 == 0) copy.mutate().timeoutMs = i;
+            checksum += copy.get().settings.size() + static_cast<size_t>(copy.get().timeoutMs);
+        }
+        auto cowTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << sessions << " session clones: deep copy " << deepTime.count() << " ms, copy-on-write "
+                  << cowTime.count() << " ms (checksum " << checksum << ")\n";
+    }
     std::cout << "\n";
 
     // Adapter
@@ -366,6 +1400,74 @@ int main() {
     std::cout << "RESULT: " << decorator1->Operation() << "\n";
     delete simple;
     delete decorator1;
+
+    // A deep chain, as in a middleware stack, rendered into one reused buffer.
+    {
+        ConcreteComponent core;
+        std::vector<std::unique_ptr<Component>> chain;
+        Component* top = &core;
+        for (int i = 0; i < 64; ++i) {
+            chain.push_back(std::make_unique<ConcreteDecoratorA>(top));
+            top = chain.back().get();
+        }
+        const int requests = 100000;
+        size_t total = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < requests; ++i) total += top->Operation().size();
+        auto perCall = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::string buffer;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < requests; ++i) {
+            buffer.clear();
+            top->AppendOperation(buffer);
+            total += buffer.size();
+        }
+        auto reused = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "64-deep chain, " << requests << " requests: Operation() " << perCall.count()
+                  << " ms, reused buffer " << reused.count() << " ms (" << total << " bytes)\n";
+    }
+    std::cout << "\n";
+
+    // Flyweight
+    std::cout << "--- Flyweight ---\n";
+    {
+        StringInterner interner;
+        Symbol engine = interner.Intern("Sports Engine");
+        std::cout << "Interning \"Sports Engine\" twice gives the same handle: "
+                  << (engine == interner.Intern(std::string("Sports ") + "Engine") ? "yes" : "no")
+                  << " (id " << engine.id << ", \"" << interner.View(engine) << "\")\n";
+
+        // Entity table: millions of records drawn from a few thousand distinct names.
+        struct EntityRecord {
+            Symbol engine;
+            Symbol body;
+        };
+        const int numThreads = 4;
+        const int recordsPerThread = 250000;
+        std::vector<std::vector<EntityRecord>> tables(numThreads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < numThreads; ++t) {
+            workers.emplace_back([&interner, &tables, t] {
+                tables[t].reserve(recordsPerThread);
+                for (int i = 0; i < recordsPerThread; ++i) {
+                    std::string engineName = "Engine model " + std::to_string((i * 7 + t) % 3000);
+                    std::string bodyName = "Body style " + std::to_string(i % 40);
+                    tables[t].push_back({interner.Intern(engineName), interner.Intern(bodyName)});
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+
+        size_t sameEngine = 0;
+        Symbol probe = tables[0][0].engine;
+        for (const auto& table : tables) {
+            for (const EntityRecord& r : table) sameEngine += (r.engine == probe);
+        }
+        std::cout << numThreads * recordsPerThread << " records, " << interner.Size() << " distinct strings, "
+                  << interner.ArenaBytes() << " arena bytes, " << sizeof(EntityRecord) << " bytes per record; "
+                  << sameEngine << " records share \"" << interner.View(probe) << "\"\n";
+    }
     std::cout << "\n";
 
     // Strategy
@@ -374,6 +1476,33 @@ int main() {
     context.doSomeBusinessLogic();
     std::cout << "\n";
 
+    // Static-dispatch Strategy
+    std::cout << "--- Static-dispatch Strategy ---\n";
+    {
+        const std::vector<std::string> letters{"a", "e", "c", "b", "d"};
+        StaticContext<SortAscending> staticContext;
+        VariantContext variantContext(SortDescending{});
+        std::cout << "Template: " << staticContext.doSomeBusinessLogic(letters) << "\n";
+        std::cout << "Variant:  " << variantContext.doSomeBusinessLogic(letters) << "\n";
+
+        // The strategy is picked at run time so the compiler cannot devirtualize.
+        volatile int selector = 0;
+        std::unique_ptr<TickStrategy> virtualStrategy;
+        if (selector == 0) virtualStrategy = std::make_unique<VirtualTickStrategy<SortAscending>>();
+        else virtualStrategy = std::make_unique<VirtualTickStrategy<SortDescending>>();
+        VariantContext tickVariant;
+        if (selector != 0) tickVariant.set_strategy(SortDescending{});
+
+        std::vector<double> ticks(10000000);
+        for (size_t i = 0; i < ticks.size(); ++i) ticks[i] = 100.0 + static_cast<double>(i % 1000) * 0.01;
+
+        const TickStrategy &virtualRef = *virtualStrategy;
+        benchmarkDispatch("Virtual dispatch:  ", ticks, [&virtualRef](double p) { return virtualRef.onTick(p); });
+        benchmarkDispatch("Variant dispatch:  ", ticks, [&tickVariant](double p) { return tickVariant.onTick(p); });
+        benchmarkDispatch("Template dispatch: ", ticks, [&staticContext](double p) { return staticContext.onTick(p); });
+    }
+    std::cout << "\n";
+
     // Observer
     std::cout << "--- Observer ---\n";
     Subject *subject = new Subject;
@@ -385,6 +1514,106 @@ int main() {
     delete observer1;
     delete observer2;
     delete subject;
+    std::cout << "\n";
+
+    // Event Bus
+    std::cout << "--- Event Bus ---\n";
+    {
+        enum Topics { Orders, Alerts, NumTopics };
+        EventBus<std::string> bus(NumTopics);
+        size_t orderCount = 0, alertCount = 0;
+        bus.Subscribe(Orders, [&orderCount](const EventBus<std::string>::Batch &batch) { orderCount += batch.size(); });
+        auto alertSub = bus.Subscribe(Alerts, [&alertCount](const EventBus<std::string>::Batch &batch) {
+            if (alertCount == 0) std::cout << "First alert: " << batch.front() << "\n";
+            alertCount += batch.size();
+        });
+
+        const int numPublishers = 4;
+        const int messagesPerPublisher = 50000;
+        std::atomic<int> running{numPublishers};
+        std::vector<std::thread> publishers;
+        for (int p = 0; p < numPublishers; ++p) {
+            publishers.emplace_back([&bus, &running, p] {
+                for (int i = 0; i < messagesPerPublisher; ++i) {
+                    std::string message = (i % 10 == 0 ? "alert " : "order ") + std::to_string(p) + ":" + std::to_string(i);
+                    size_t topic = (i % 10 == 0) ? Alerts : Orders;
+                    while (!bus.Publish(topic, message)) std::this_thread::yield();
+                }
+                running.fetch_sub(1);
+            });
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (;;) {
+            bool publishersDone = running.load() == 0;
+            if (bus.Dispatch() == 0 && publishersDone) break;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        for (auto &t : publishers) t.join();
+        bus.Unsubscribe(Alerts, alertSub);
+
+        std::cout << "Delivered " << orderCount << " orders and " << alertCount << " alerts in "
+                  << bus.BatchCount() << " batches (" << elapsed.count() << " ms)\n";
+    }
+    std::cout << "\n";
+
+    // Command
+    std::cout << "--- Command ---\n";
+    {
+        OrderBook book;
+        CommandBuffer<OrderBook> commands;
+        commands.Record<AddQuantityCommand>(0u, int64_t{100});
+        commands.Record<SetLimitCommand>(0u, 101.5);
+        commands.Record<AddQuantityCommand>(0u, int64_t{-40});
+        commands.ExecuteBatch(book);
+        std::cout << "After 3 commands: position " << book.position[0] << ", limit " << book.limitPrice[0] << "\n";
+        commands.Undo(book, 2);
+        std::cout << "After undoing 2: position " << book.position[0] << ", limit " << book.limitPrice[0] << "\n";
+        commands.ExecuteBatch(book);
+        OrderBook replica;
+        commands.Replay(replica);
+        std::cout << "After redo: position " << book.position[0] << ", replayed replica position " << replica.position[0] << "\n";
+        commands.Undo(book, 3);
+        std::cout << "After undoing all: position " << book.position[0] << ", limit " << book.limitPrice[0] << "\n";
+
+        // Recording after an undo drops only the undone command, not the pending ones.
+        OrderBook pendingBook;
+        CommandBuffer<OrderBook> pending;
+        pending.Record<AddQuantityCommand>(1u, int64_t{1});
+        pending.Record<AddQuantityCommand>(1u, int64_t{10});
+        pending.Record<AddQuantityCommand>(1u, int64_t{100});
+        pending.ExecuteBatch(pendingBook, 1);
+        pending.Undo(pendingBook, 1);
+        pending.Record<AddQuantityCommand>(1u, int64_t{1000});
+        size_t ran = pending.ExecuteBatch(pendingBook);
+        assert(ran == 3 && pending.Size() == 3 && pendingBook.position[1] == 1110);
+        std::cout << "Record after undo: ran " << ran << " of " << pending.Size() << " commands, position "
+                  << pendingBook.position[1] << "\n";
+        pending.Undo(pendingBook, 3);
+        std::cout << "Undoing them again: position " << pendingBook.position[1] << "\n";
+
+        const int numCommands = 1000000;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<ICommand>> heapCommands;
+        for (int i = 0; i < numCommands; ++i) {
+            heapCommands.push_back(std::make_unique<HeapAddQuantity>(static_cast<uint32_t>(i & 15), int64_t{1}));
+        }
+        OrderBook heapBook;
+        for (auto& command : heapCommands) command->Execute(heapBook);
+        auto heapTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        CommandBuffer<OrderBook> buffer;
+        for (int i = 0; i < numCommands; ++i) {
+            buffer.Record<AddQuantityCommand>(static_cast<uint32_t>(i & 15), int64_t{1});
+        }
+        OrderBook arenaBook;
+        while (buffer.ExecuteBatch(arenaBook, 4096) > 0) {}
+        auto arenaTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << numCommands << " commands: new + virtual " << heapTime.count() << " ms, arena buffer "
+                  << arenaTime.count() << " ms (" << buffer.Bytes() << " bytes, positions "
+                  << heapBook.position[3] << "/" << arenaBook.position[3] << ")\n";
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -3,6 +3,17 @@
 #include <string>
 #include <cstring>
 #include <algorithm>
+#include <string_view>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <memory>
+#include <cstdlib>
+#include <thread>
+#include <cmath>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 void printIntArray(const int* arr, int size) {
     for (int i = 0; i < size; ++i) {
@@ -80,11 +91,541 @@ void stdString() {
     std::cout << "Reversed sentence: " << sentence << std::endl;
 }
 
+// ASCII/UTF-8 helpers that work on 16 or 32 bytes per step (SSE2/AVX2) and fall
+// back to the byte-at-a-time versions in textsimd::scalar elsewhere.
+namespace textsimd {
+
+namespace scalar {
+
+inline char toLower(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c; }
+inline char toUpper(char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c & ~0x20) : c; }
+
+inline void toLowerAscii(char* p, size_t n) {
+    for (size_t i = 0; i < n; ++i) p[i] = toLower(p[i]);
+}
+
+inline void toUpperAscii(char* p, size_t n) {
+    for (size_t i = 0; i < n; ++i) p[i] = toUpper(p[i]);
+}
+
+inline bool equalsIgnoreCase(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (toLower(a[i]) != toLower(b[i])) return false;
+    }
+    return true;
+}
+
+inline size_t find(std::string_view haystack, std::string_view needle, size_t from = 0) {
+    return haystack.find(needle, from);
+}
+
+inline void split(std::string_view s, char delim, size_t from, size_t& start, std::vector<std::string_view>& out) {
+    for (size_t i = from; i < s.size(); ++i) {
+        if (s[i] == delim) {
+            out.push_back(s.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+}
+
+// Length of the well-formed UTF-8 sequence at p, or 0 if it is malformed
+// (bad lead/continuation byte, truncated, overlong, surrogate, > U+10FFFF).
+inline size_t sequenceLength(const unsigned char* p, size_t remaining) {
+    unsigned char c = p[0];
+    size_t len;
+    uint32_t cp;
+    if (c < 0x80) return 1;
+    if ((c & 0xE0) == 0xC0) { len = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { len = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { len = 4; cp = c & 0x07; }
+    else return 0;
+    if (len > remaining) return 0;
+    for (size_t k = 1; k < len; ++k) {
+        if ((p[k] & 0xC0) != 0x80) return 0;
+        cp = (cp << 6) | (p[k] & 0x3F);
+    }
+    if ((len == 2 && cp < 0x80) || (len == 3 && cp < 0x800) || (len == 4 && (cp < 0x10000 || cp > 0x10FFFF))) return 0;
+    if (cp >= 0xD800 && cp <= 0xDFFF) return 0;
+    return len;
+}
+
+inline bool isValidUtf8(std::string_view s, size_t from = 0) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+    for (size_t i = from; i < s.size();) {
+        size_t len = sequenceLength(p + i, s.size() - i);
+        if (len == 0) return false;
+        i += len;
+    }
+    return true;
+}
+
+} // namespace scalar
+
+#if defined(__AVX2__)
+using Vec = __m256i;
+constexpr size_t kWidth = 32;
+inline Vec load(const char* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+inline void store(char* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+inline Vec splat(char c) { return _mm256_set1_epi8(c); }
+inline uint32_t eqMask(Vec a, Vec b) { return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+inline uint32_t highBits(Vec v) { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+// Bytes in [lo, lo + 26): shift the range down to start at -128, then one signed compare.
+inline Vec letterMask(Vec v, char lo) {
+    Vec shifted = _mm256_add_epi8(v, splat(static_cast<char>(0x80 - lo)));
+    return _mm256_cmpgt_epi8(splat(static_cast<char>(-128 + 26)), shifted);
+}
+inline Vec andBits(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+inline Vec orBits(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+inline Vec xorBits(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+#elif defined(__SSE2__)
+using Vec = __m128i;
+constexpr size_t kWidth = 16;
+inline Vec load(const char* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline void store(char* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+inline Vec splat(char c) { return _mm_set1_epi8(c); }
+inline uint32_t eqMask(Vec a, Vec b) { return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+inline uint32_t highBits(Vec v) { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+inline Vec letterMask(Vec v, char lo) {
+    Vec shifted = _mm_add_epi8(v, splat(static_cast<char>(0x80 - lo)));
+    return _mm_cmpgt_epi8(splat(static_cast<char>(-128 + 26)), shifted);
+}
+inline Vec andBits(Vec a, Vec b) { return _mm_and_si128(a, b); }
+inline Vec orBits(Vec a, Vec b) { return _mm_or_si128(a, b); }
+inline Vec xorBits(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+#endif
+
+#if defined(__SSE2__)
+constexpr uint32_t kAllLanes = kWidth == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+
+inline Vec foldLower(Vec v) { return orBits(v, andBits(letterMask(v, 'A'), splat(0x20))); }
+#endif
+
+inline void toLowerAscii(std::string& s) {
+    char* p = s.data();
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + kWidth <= s.size(); i += kWidth) {
+        store(p + i, foldLower(load(p + i)));
+    }
+#endif
+    scalar::toLowerAscii(p + i, s.size() - i);
+}
+
+inline void toUpperAscii(std::string& s) {
+    char* p = s.data();
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + kWidth <= s.size(); i += kWidth) {
+        Vec v = load(p + i);
+        store(p + i, xorBits(v, andBits(letterMask(v, 'a'), splat(0x20))));
+    }
+#endif
+    scalar::toUpperAscii(p + i, s.size() - i);
+}
+
+inline bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + kWidth <= a.size(); i += kWidth) {
+        if (eqMask(foldLower(load(a.data() + i)), foldLower(load(b.data() + i))) != kAllLanes) return false;
+    }
+#endif
+    return scalar::equalsIgnoreCase(a.data() + i, b.data() + i, a.size() - i);
+}
+
+// Candidate positions are those where both the first and the last byte of the
+// needle match; only those are confirmed with memcmp.
+inline size_t find(std::string_view haystack, std::string_view needle) {
+    size_t n = haystack.size(), k = needle.size();
+    if (k == 0) return 0;
+    if (k > n) return std::string_view::npos;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const char* h = haystack.data();
+    Vec first = splat(needle.front());
+    Vec last = splat(needle.back());
+    for (; i + k - 1 + kWidth <= n; i += kWidth) {
+        uint32_t mask = eqMask(load(h + i), first) & eqMask(load(h + i + k - 1), last);
+        while (mask != 0) {
+            size_t pos = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (std::memcmp(h + pos, needle.data(), k) == 0) return pos;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    return scalar::find(haystack, needle, i);
+}
+
+// Fills out (cleared first) so callers can reuse its capacity across records.
+inline void split(std::string_view s, char delim, std::vector<std::string_view>& out) {
+    out.clear();
+    size_t start = 0, i = 0;
+#if defined(__SSE2__)
+    Vec d = splat(delim);
+    for (; i + kWidth <= s.size(); i += kWidth) {
+        for (uint32_t mask = eqMask(load(s.data() + i), d); mask != 0; mask &= mask - 1) {
+            size_t pos = i + static_cast<size_t>(__builtin_ctz(mask));
+            out.push_back(s.substr(start, pos - start));
+            start = pos + 1;
+        }
+    }
+#endif
+    scalar::split(s, delim, i, start, out);
+    out.push_back(s.substr(start));
+}
+
+inline std::vector<std::string_view> split(std::string_view s, char delim) {
+    std::vector<std::string_view> out;
+    split(s, delim, out);
+    return out;
+}
+
+// Skips pure-ASCII blocks with one movemask; multi-byte sequences are checked
+// by the scalar decoder, which then resumes the block scan after them.
+inline bool isValidUtf8(std::string_view s) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+    while (i + kWidth <= s.size()) {
+        uint32_t nonAscii = highBits(load(s.data() + i));
+        if (nonAscii == 0) {
+            i += kWidth;
+            continue;
+        }
+        i += static_cast<size_t>(__builtin_ctz(nonAscii));
+        size_t len = scalar::sequenceLength(p + i, s.size() - i);
+        if (len == 0) return false;
+        i += len;
+    }
+#endif
+    return scalar::isValidUtf8(s, i);
+}
+
+} // namespace textsimd
+
+template <typename Fn>
+double gigabytesPerSecond(size_t bytes, int repeats, Fn&& fn) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r) fn();
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    return static_cast<double>(bytes) * repeats / elapsed.count() / 1e9;
+}
+
+void simdStrings() {
+    std::cout << "\n--- SIMD String Utilities ---" << std::endl;
+    std::string s3 = "Hello World";
+    std::string upper = s3;
+    textsimd::toUpperAscii(upper);
+    std::cout << "Upper: " << upper << ", equalsIgnoreCase: " << std::boolalpha
+              << textsimd::equalsIgnoreCase(s3, upper) << std::endl;
+    std::cout << "'World' found at position: " << textsimd::find(s3, "World") << std::endl;
+    std::cout << "Fields:";
+    for (std::string_view field : textsimd::split("id,name,,city", ',')) {
+        std::cout << " [" << field << "]";
+    }
+    std::cout << std::endl;
+    std::cout << "Valid UTF-8 \"caf\\xc3\\xa9\": " << textsimd::isValidUtf8("caf\xc3\xa9")
+              << ", truncated \"caf\\xc3\": " << textsimd::isValidUtf8("caf\xc3") << std::endl;
+
+    // Benchmark on 32 MB of CSV-like text with occasional accented characters.
+    const size_t bytes = size_t{32} << 20;
+    std::mt19937 rng(44);
+    std::string text;
+    text.reserve(bytes + 16);
+    const char* words[] = {"Alpha", "beta", "GAMMA", "delta", "Epsilon", "caf\xc3\xa9", "zeta", "Eta"};
+    while (text.size() < bytes) {
+        text += words[rng() % 8];
+        text += (rng() % 4 == 0) ? ',' : ' ';
+    }
+    std::string other = text;
+    textsimd::toUpperAscii(other);
+    const int repeats = 5;
+    size_t sink = 0;
+
+    auto report = [&](const char* name, double scalarRate, double simdRate) {
+        std::cout << name << ": scalar " << scalarRate << " GB/s, SIMD " << simdRate << " GB/s" << std::endl;
+    };
+    std::string work = text;
+    report("toLowerAscii",
+           gigabytesPerSecond(work.size(), repeats, [&] { textsimd::scalar::toLowerAscii(work.data(), work.size()); }),
+           gigabytesPerSecond(work.size(), repeats, [&] { textsimd::toLowerAscii(work); }));
+    report("equalsIgnoreCase",
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::scalar::equalsIgnoreCase(text.data(), other.data(), text.size()); }),
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::equalsIgnoreCase(text, other); }));
+    const std::string_view needle = "Eta Omega";
+    report("find (absent)",
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::scalar::find(text, needle); }),
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::find(text, needle); }));
+    std::vector<std::string_view> fields;
+    textsimd::split(text, ',', fields);
+    report("split",
+           gigabytesPerSecond(text.size(), repeats, [&] {
+               size_t start = 0;
+               fields.clear();
+               textsimd::scalar::split(text, ',', 0, start, fields);
+               sink += fields.size();
+           }),
+           gigabytesPerSecond(text.size(), repeats, [&] {
+               textsimd::split(text, ',', fields);
+               sink += fields.size();
+           }));
+    report("isValidUtf8",
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::scalar::isValidUtf8(text); }),
+           gigabytesPerSecond(text.size(), repeats, [&] { sink += textsimd::isValidUtf8(text); }));
+    std::cout << "(checksum " << sink << ")" << std::endl;
+}
+
+// Dense row-major float matrix. Rows are padded to a multiple of 16 floats and
+// the storage is 64-byte aligned, so every row starts on a cache line.
+struct AlignedFree {
+    void operator()(float* p) const { std::free(p); }
+};
+using AlignedFloats = std::unique_ptr<float[], AlignedFree>;
+
+inline AlignedFloats allocateAligned(size_t count) {
+    size_t bytes = (count * sizeof(float) + 63) & ~size_t{63};
+    auto* p = static_cast<float*>(std::aligned_alloc(64, bytes == 0 ? 64 : bytes));
+    if (p == nullptr) throw std::bad_alloc();
+    return AlignedFloats(p);
+}
+
+class Matrix {
+public:
+    Matrix(size_t rows, size_t cols)
+        : rows_(rows), cols_(cols), stride_((cols + 15) & ~size_t{15}), data_(allocateAligned(rows * stride_)) {
+        std::fill(data_.get(), data_.get() + rows_ * stride_, 0.0f);
+    }
+
+    float& operator()(size_t r, size_t c) { return data_[r * stride_ + c]; }
+    float operator()(size_t r, size_t c) const { return data_[r * stride_ + c]; }
+    float* row(size_t r) { return data_.get() + r * stride_; }
+    const float* row(size_t r) const { return data_.get() + r * stride_; }
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    size_t stride() const { return stride_; }
+
+private:
+    size_t rows_, cols_, stride_;
+    AlignedFloats data_;
+};
+
+void multiplyNaive(const Matrix& a, const Matrix& b, Matrix& c) {
+    for (size_t i = 0; i < a.rows(); ++i) {
+        for (size_t j = 0; j < b.cols(); ++j) {
+            float sum = 0.0f;
+            for (size_t k = 0; k < a.cols(); ++k) {
+                sum += a(i, k) * b(k, j);
+            }
+            c(i, j) = sum;
+        }
+    }
+}
+
+// Blocked GEMM in the usual three-level layout:
+//   NC columns of B, KC-deep slice  -> packed once, stays in L3/L2
+//   MC rows of A, same KC slice     -> packed per block, stays in L2
+//   MR x NR tile of C               -> held in registers by the micro-kernel
+// Packing rearranges A into MR-row slivers and B into NR-column slivers so the
+// micro-kernel reads both sequentially.
+namespace gemm {
+
+constexpr size_t MR = 6, NR = 16;
+constexpr size_t KC = 256, MC = 96, NC = 2048;
+
+inline void packA(const Matrix& a, size_t i0, size_t mc, size_t p0, size_t kc, float* out) {
+    for (size_t ir = 0; ir < mc; ir += MR) {
+        for (size_t p = 0; p < kc; ++p) {
+            for (size_t r = 0; r < MR; ++r) {
+                *out++ = ir + r < mc ? a(i0 + ir + r, p0 + p) : 0.0f;
+            }
+        }
+    }
+}
+
+inline void packB(const Matrix& b, size_t p0, size_t kc, size_t j0, size_t nc, float* out) {
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        for (size_t p = 0; p < kc; ++p) {
+            const float* src = b.row(p0 + p) + j0 + jr;
+            for (size_t col = 0; col < NR; ++col) {
+                *out++ = jr + col < nc ? src[col] : 0.0f;
+            }
+        }
+    }
+}
+
+// c[MR x NR] += a_sliver * b_sliver, with c rows ldc floats apart.
+inline void microKernel(size_t kc, const float* a, const float* b, float* c, size_t ldc) {
+#if defined(__AVX2__) && defined(__FMA__)
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+    for (size_t p = 0; p < kc; ++p, a += MR, b += NR) {
+        __m256 b0 = _mm256_load_ps(b);
+        __m256 b1 = _mm256_load_ps(b + 8);
+        __m256 x = _mm256_broadcast_ss(a + 0);
+        c00 = _mm256_fmadd_ps(x, b0, c00); c01 = _mm256_fmadd_ps(x, b1, c01);
+        x = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(x, b0, c10); c11 = _mm256_fmadd_ps(x, b1, c11);
+        x = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(x, b0, c20); c21 = _mm256_fmadd_ps(x, b1, c21);
+        x = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(x, b0, c30); c31 = _mm256_fmadd_ps(x, b1, c31);
+        x = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(x, b0, c40); c41 = _mm256_fmadd_ps(x, b1, c41);
+        x = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(x, b0, c50); c51 = _mm256_fmadd_ps(x, b1, c51);
+    }
+    const __m256 acc[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t r = 0; r < MR; ++r) {
+        float* dst = c + r * ldc;
+        _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), acc[r][0]));
+        _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_loadu_ps(dst + 8), acc[r][1]));
+    }
+#else
+    float acc[MR][NR] = {};
+    for (size_t p = 0; p < kc; ++p, a += MR, b += NR) {
+        for (size_t r = 0; r < MR; ++r) {
+            for (size_t col = 0; col < NR; ++col) {
+                acc[r][col] += a[r] * b[col];
+            }
+        }
+    }
+    for (size_t r = 0; r < MR; ++r) {
+        for (size_t col = 0; col < NR; ++col) {
+            c[r * ldc + col] += acc[r][col];
+        }
+    }
+#endif
+}
+
+// Multiplies one packed MC x KC block of A with the packed KC x NC panel of B
+// into C at (i0, j0). Edge tiles go through a scratch tile.
+inline void macroKernel(size_t mc, size_t nc, size_t kc, const float* packedA, const float* packedB,
+                        Matrix& c, size_t i0, size_t j0) {
+    for (size_t jr = 0; jr < nc; jr += NR) {
+        for (size_t ir = 0; ir < mc; ir += MR) {
+            const float* a = packedA + ir * kc;
+            const float* b = packedB + jr * kc;
+            if (ir + MR <= mc && jr + NR <= nc) {
+                microKernel(kc, a, b, c.row(i0 + ir) + j0 + jr, c.stride());
+                continue;
+            }
+            alignas(32) float tile[MR * NR] = {};
+            microKernel(kc, a, b, tile, NR);
+            for (size_t r = 0; r < std::min(MR, mc - ir); ++r) {
+                for (size_t col = 0; col < std::min(NR, nc - jr); ++col) {
+                    c(i0 + ir + r, j0 + jr + col) += tile[r * NR + col];
+                }
+            }
+        }
+    }
+}
+
+// c = a * b. With threads > 1 the MC row blocks of each panel are shared out
+// round-robin; every thread packs its own A blocks into a private buffer.
+void multiply(const Matrix& a, const Matrix& b, Matrix& c, unsigned threads = 1) {
+    const size_t m = a.rows(), n = b.cols(), k = a.cols();
+    for (size_t i = 0; i < m; ++i) {
+        std::fill(c.row(i), c.row(i) + n, 0.0f);
+    }
+    threads = std::max(1u, threads);
+    AlignedFloats packedB = allocateAligned(KC * ((std::min(NC, n) + NR - 1) / NR * NR));
+    std::vector<AlignedFloats> packedA;
+    for (unsigned t = 0; t < threads; ++t) {
+        packedA.push_back(allocateAligned(KC * MC));
+    }
+    const size_t blocks = (m + MC - 1) / MC;
+
+    for (size_t jc = 0; jc < n; jc += NC) {
+        const size_t nc = std::min(NC, n - jc);
+        for (size_t pc = 0; pc < k; pc += KC) {
+            const size_t kc = std::min(KC, k - pc);
+            packB(b, pc, kc, jc, nc, packedB.get());
+            auto worker = [&](unsigned t) {
+                for (size_t block = t; block < blocks; block += threads) {
+                    const size_t ic = block * MC, mc = std::min(MC, m - ic);
+                    packA(a, ic, mc, pc, kc, packedA[t].get());
+                    macroKernel(mc, nc, kc, packedA[t].get(), packedB.get(), c, ic, jc);
+                }
+            };
+            std::vector<std::thread> pool;
+            for (unsigned t = 1; t < threads; ++t) {
+                pool.emplace_back(worker, t);
+            }
+            worker(0);
+            for (std::thread& th : pool) {
+                th.join();
+            }
+        }
+    }
+}
+
+} // namespace gemm
+
+void matrixMultiplication() {
+    std::cout << "\n--- Matrix Multiplication ---" << std::endl;
+    Matrix a(2, 3), b(3, 2), c(2, 2);
+    int value = 1;
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            a(i, j) = static_cast<float>(value);
+            b(j, i) = static_cast<float>(value++);
+        }
+    }
+    gemm::multiply(a, b, c);
+    std::cout << c(0, 0) << " " << c(0, 1) << std::endl << c(1, 0) << " " << c(1, 1) << std::endl;
+
+    // GFLOP/s sweep. The naive loop is cubic and slow, so it stops at
+    // kMaxNaive; raise both limits to 4096 on a machine with time to spare.
+    const size_t kMaxBlocked = 2048, kMaxNaive = 512;
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::mt19937 rng(45);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    auto gflops = [](size_t n, double seconds) { return 2.0 * n * n * n / seconds / 1e9; };
+    auto seconds = [](auto&& fn) {
+        auto start = std::chrono::high_resolution_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    for (size_t n = 64; n <= kMaxBlocked; n *= 2) {
+        Matrix x(n, n), y(n, n), blocked(n, n), parallel(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                x(i, j) = dist(rng);
+                y(i, j) = dist(rng);
+            }
+        }
+        double blockedTime = seconds([&] { gemm::multiply(x, y, blocked); });
+        double parallelTime = seconds([&] { gemm::multiply(x, y, parallel, threads); });
+        std::cout << n << "x" << n << ": blocked " << gflops(n, blockedTime) << " GFLOP/s, "
+                  << threads << "-thread " << gflops(n, parallelTime) << " GFLOP/s";
+        if (n <= kMaxNaive) {
+            Matrix naive(n, n);
+            double naiveTime = seconds([&] { multiplyNaive(x, y, naive); });
+            float maxError = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    maxError = std::max(maxError, std::fabs(naive(i, j) - blocked(i, j)));
+                }
+            }
+            std::cout << ", naive " << gflops(n, naiveTime) << " GFLOP/s (max error " << maxError << ")";
+        }
+        std::cout << std::endl;
+    }
+}
+
 int main() {
     cStyleArrays();
     stdVector();
     cStyleStrings();
     stdString();
+    simdStrings();
+    matrixMultiplication();
 
     return 0;
 }
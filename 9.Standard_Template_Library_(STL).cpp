@@ -5,6 +5,1605 @@
 #include <set>
 #include <algorithm>
 #include <string>
+#include <functional>
+#include <utility>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <stdexcept>
+#include <iterator>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <deque>
+#include <limits>
+// std::execution::par needs TBB with libstdc++; build with
+// g++ -std=c++17 -DWITH_PARALLEL_STL ... -ltbb to include it in the sort benchmark.
+#ifdef WITH_PARALLEL_STL
+#include <execution>
+#endif
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+
+// --- Flat containers ---
+// Sorted contiguous storage instead of red-black tree nodes: lookups touch a
+// few cache lines of one array, and bulk loading is one sort. Single inserts
+// are O(n), so the intended use is load-then-read.
+
+// Branchless lower_bound: the loop always runs log2(n) times and the compare
+// turns into a conditional move, so there are no mispredicted branches.
+template <typename T, typename Key, typename Less>
+const T* branchlessLowerBound(const T* first, size_t n, const Key& key, Less less) {
+    if (n == 0) {
+        return first;
+    }
+    while (n > 1) {
+        size_t half = n / 2;
+        first = less(first[half - 1], key) ? first + half : first;
+        n -= half;
+    }
+    return first + less(*first, key);
+}
+
+template <typename T, typename Compare = std::less<T>>
+class flat_set {
+public:
+    using iterator = typename std::vector<T>::const_iterator;
+
+    flat_set() = default;
+    flat_set(std::initializer_list<T> init) { insert_bulk(init.begin(), init.end()); }
+
+    bool insert(const T& value) {
+        auto it = lowerBound(value);
+        if (it != data_.end() && !comp_(value, *it)) {
+            return false;
+        }
+        data_.insert(it, value);
+        return true;
+    }
+
+    // Appends the range, then sorts and merges once.
+    template <typename It>
+    void insert_bulk(It first, It last) {
+        size_t oldSize = data_.size();
+        data_.insert(data_.end(), first, last);
+        std::sort(data_.begin() + static_cast<std::ptrdiff_t>(oldSize), data_.end(), comp_);
+        std::inplace_merge(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(oldSize), data_.end(), comp_);
+        auto equal = [this](const T& a, const T& b) { return !comp_(a, b) && !comp_(b, a); };
+        data_.erase(std::unique(data_.begin(), data_.end(), equal), data_.end());
+    }
+
+    bool erase(const T& value) {
+        auto it = lowerBound(value);
+        if (it == data_.end() || comp_(value, *it)) {
+            return false;
+        }
+        data_.erase(it);
+        return true;
+    }
+
+    iterator find(const T& value) const {
+        const T* p = branchlessLowerBound(data_.data(), data_.size(), value, comp_);
+        if (p == data_.data() + data_.size() || comp_(value, *p)) {
+            return data_.end();
+        }
+        return data_.begin() + (p - data_.data());
+    }
+
+    bool contains(const T& value) const { return find(value) != data_.end(); }
+
+    iterator begin() const { return data_.begin(); }
+    iterator end() const { return data_.end(); }
+    size_t size() const { return data_.size(); }
+    bool empty() const { return data_.empty(); }
+    void reserve(size_t n) { data_.reserve(n); }
+    const std::vector<T>& values() const { return data_; }
+
+private:
+    typename std::vector<T>::iterator lowerBound(const T& value) {
+        return std::lower_bound(data_.begin(), data_.end(), value, comp_);
+    }
+
+    std::vector<T> data_;
+    Compare comp_;
+};
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class flat_map {
+public:
+    using value_type = std::pair<Key, Value>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    flat_map() = default;
+    flat_map(std::initializer_list<value_type> init) { insert_bulk(init.begin(), init.end()); }
+
+    Value& operator[](const Key& key) {
+        auto it = lowerBound(key);
+        if (it == data_.end() || comp_(key, it->first)) {
+            it = data_.insert(it, value_type(key, Value()));
+        }
+        return it->second;
+    }
+
+    std::pair<iterator, bool> insert_or_assign(const Key& key, Value value) {
+        auto it = lowerBound(key);
+        if (it != data_.end() && !comp_(key, it->first)) {
+            it->second = std::move(value);
+            return {it, false};
+        }
+        return {data_.insert(it, value_type(key, std::move(value))), true};
+    }
+
+    // Appends the range, then sorts and merges once. For duplicate keys the
+    // first occurrence (existing entries before new ones) wins, as with std::map::insert.
+    template <typename It>
+    void insert_bulk(It first, It last) {
+        size_t oldSize = data_.size();
+        data_.insert(data_.end(), first, last);
+        auto byKey = [this](const value_type& a, const value_type& b) { return comp_(a.first, b.first); };
+        std::stable_sort(data_.begin() + static_cast<std::ptrdiff_t>(oldSize), data_.end(), byKey);
+        std::inplace_merge(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(oldSize), data_.end(), byKey);
+        auto sameKey = [this](const value_type& a, const value_type& b) { return !comp_(a.first, b.first) && !comp_(b.first, a.first); };
+        data_.erase(std::unique(data_.begin(), data_.end(), sameKey), data_.end());
+    }
+
+    bool erase(const Key& key) {
+        auto it = lowerBound(key);
+        if (it == data_.end() || comp_(key, it->first)) {
+            return false;
+        }
+        data_.erase(it);
+        return true;
+    }
+
+    const_iterator find(const Key& key) const {
+        auto less = [this](const value_type& entry, const Key& k) { return comp_(entry.first, k); };
+        const value_type* p = branchlessLowerBound(data_.data(), data_.size(), key, less);
+        if (p == data_.data() + data_.size() || comp_(key, p->first)) {
+            return data_.end();
+        }
+        return data_.begin() + (p - data_.data());
+    }
+
+    bool contains(const Key& key) const { return find(key) != data_.end(); }
+
+    iterator begin() { return data_.begin(); }
+    iterator end() { return data_.end(); }
+    const_iterator begin() const { return data_.begin(); }
+    const_iterator end() const { return data_.end(); }
+    size_t size() const { return data_.size(); }
+    bool empty() const { return data_.empty(); }
+    void reserve(size_t n) { data_.reserve(n); }
+
+private:
+    iterator lowerBound(const Key& key) {
+        return std::lower_bound(data_.begin(), data_.end(), key,
+                                [this](const value_type& entry, const Key& k) { return comp_(entry.first, k); });
+    }
+
+    std::vector<value_type> data_;
+    Compare comp_;
+};
+
+// Read-only Eytzinger (BFS heap order) layout of sorted keys. The first levels
+// of the search tree share a few cache lines, and the children of node k sit
+// next to each other, so the next levels can be prefetched while comparing.
+template <typename T>
+class EytzingerIndex {
+public:
+    explicit EytzingerIndex(const std::vector<T>& sorted)
+        : keys_(sorted.size() + 1), rank_(sorted.size() + 1), n_(sorted.size()) {
+        size_t i = 0;
+        build(sorted, i, 1);
+    }
+
+    // Position in the original sorted vector of the first key >= value, or size() if none.
+    size_t lower_bound(const T& value) const {
+        size_t k = search(value);
+        return k == 0 ? n_ : rank_[k];
+    }
+
+    bool contains(const T& value) const {
+        size_t k = search(value);
+        return k != 0 && !(value < keys_[k]);
+    }
+
+    size_t size() const { return n_; }
+
+private:
+    // Returns the 1-based Eytzinger slot of the lower bound, 0 if every key is smaller.
+    size_t search(const T& value) const {
+        size_t k = 1;
+        while (k <= n_) {
+            __builtin_prefetch(keys_.data() + std::min(k * 16, n_));
+            k = 2 * k + (keys_[k] < value);
+        }
+        return k >> __builtin_ffsll(static_cast<long long>(~k));
+    }
+
+    void build(const std::vector<T>& sorted, size_t& i, size_t k) {
+        if (k <= n_) {
+            build(sorted, i, 2 * k);
+            keys_[k] = sorted[i];
+            rank_[k] = i++;
+            build(sorted, i, 2 * k + 1);
+        }
+    }
+
+    std::vector<T> keys_;
+    std::vector<size_t> rank_;
+    size_t n_;
+};
+
+// --- Open-addressing hash map ---
+// Swiss-table layout: one control byte per slot holds either a state (empty,
+// deleted) or the low 7 bits of the key's hash. A lookup compares those bytes
+// for a whole group of slots at once (32 with AVX2, 16 with SSE2, 8 with the
+// scalar fallback) and only touches the slots whose byte matched. Groups are
+// probed quadratically and a lookup stops at the first group with an empty slot.
+namespace swiss {
+
+constexpr int8_t kEmpty = -128;  // 0b10000000
+constexpr int8_t kDeleted = -2;  // 0b11111110
+
+#if defined(__AVX2__)
+constexpr size_t kGroupWidth = 32;
+inline uint32_t matchByte(const int8_t* ctrl, int8_t h) {
+    __m256i group = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(group, _mm256_set1_epi8(h))));
+}
+#elif defined(__SSE2__)
+constexpr size_t kGroupWidth = 16;
+inline uint32_t matchByte(const int8_t* ctrl, int8_t h) {
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h))));
+}
+#else
+constexpr size_t kGroupWidth = 8;
+inline uint32_t matchByte(const int8_t* ctrl, int8_t h) {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; ++i) {
+        mask |= static_cast<uint32_t>(ctrl[i] == h) << i;
+    }
+    return mask;
+}
+#endif
+
+// Hash for string keys that also accepts string_view and const char* without building a std::string.
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+template <typename K>
+using DefaultHash = std::conditional_t<std::is_same_v<K, std::string>, StringHash, std::hash<K>>;
+
+template <typename K>
+using DefaultEqual = std::conditional_t<std::is_same_v<K, std::string>, std::equal_to<>, std::equal_to<K>>;
+
+// std::hash of an integer is the identity; mix it so both the group index
+// (high bits) and the 7-bit tag (low bits) are well distributed.
+inline uint64_t mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+} // namespace swiss
+
+template <typename Key, typename Value, typename Hash = swiss::DefaultHash<Key>, typename Equal = swiss::DefaultEqual<Key>>
+class flat_hash_map {
+public:
+    using value_type = std::pair<const Key, Value>;
+
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+        basic_iterator() = default;
+        basic_iterator(const flat_hash_map* map, size_t index) : map_(map), index_(index) { skipEmpty(); }
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : map_(other.map_), index_(other.index_) {}
+
+        reference operator*() const { return *const_cast<flat_hash_map*>(map_)->slot(index_); }
+        pointer operator->() const { return const_cast<flat_hash_map*>(map_)->slot(index_); }
+        basic_iterator& operator++() {
+            ++index_;
+            skipEmpty();
+            return *this;
+        }
+        bool operator==(const basic_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const basic_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        friend class flat_hash_map;
+        void skipEmpty() {
+            while (index_ < map_->capacity_ && map_->ctrl_[index_] < 0) {
+                ++index_;
+            }
+        }
+        const flat_hash_map* map_ = nullptr;
+        size_t index_ = 0;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    flat_hash_map() = default;
+    flat_hash_map(std::initializer_list<std::pair<Key, Value>> init) {
+        reserve(init.size());
+        for (const auto& kv : init) {
+            try_emplace(kv.first, kv.second);
+        }
+    }
+    flat_hash_map(const flat_hash_map&) = delete;
+    flat_hash_map& operator=(const flat_hash_map&) = delete;
+    flat_hash_map(flat_hash_map&& other) noexcept { swap(other); }
+    flat_hash_map& operator=(flat_hash_map&& other) noexcept {
+        swap(other);
+        return *this;
+    }
+    ~flat_hash_map() {
+        destroyAll();
+        release();
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        size_t h = hashOf(key);
+        size_t found = findIndex(key, h);
+        if (found != npos) {
+            return {iterator(this, found), false};
+        }
+        if (size_ + deleted_ + 1 > capacity_ / 8 * 7) {
+            rehash(std::max<size_t>(capacity_ * 2, swiss::kGroupWidth));
+        }
+        size_t index = findInsertSlot(h);
+        if (ctrl_[index] == swiss::kDeleted) {
+            --deleted_;
+        }
+        ctrl_[index] = tag(h);
+        new (slot(index)) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+                                     std::forward_as_tuple(std::forward<Args>(args)...));
+        ++size_;
+        return {iterator(this, index), true};
+    }
+
+    std::pair<iterator, bool> insert(const std::pair<Key, Value>& kv) { return try_emplace(kv.first, kv.second); }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    template <typename K>
+    iterator find(const K& key) {
+        size_t index = findIndex(key, hashOf(key));
+        return index == npos ? end() : iterator(this, index);
+    }
+    template <typename K>
+    const_iterator find(const K& key) const {
+        size_t index = findIndex(key, hashOf(key));
+        return index == npos ? end() : const_iterator(this, index);
+    }
+    template <typename K>
+    bool contains(const K& key) const { return findIndex(key, hashOf(key)) != npos; }
+
+    template <typename K>
+    bool erase(const K& key) {
+        size_t index = findIndex(key, hashOf(key));
+        if (index == npos) {
+            return false;
+        }
+        slot(index)->~value_type();
+        --size_;
+        // A slot may go back to empty only if its group already has an empty slot:
+        // then no probe sequence can have continued past this group.
+        size_t groupStart = index & ~(swiss::kGroupWidth - 1);
+        if (swiss::matchByte(ctrl_ + groupStart, swiss::kEmpty) != 0) {
+            ctrl_[index] = swiss::kEmpty;
+        } else {
+            ctrl_[index] = swiss::kDeleted;
+            ++deleted_;
+        }
+        return true;
+    }
+
+    void reserve(size_t n) {
+        size_t needed = swiss::kGroupWidth;
+        while (needed / 8 * 7 < n) {
+            needed *= 2;
+        }
+        if (needed > capacity_) {
+            rehash(needed);
+        }
+    }
+
+    void clear() {
+        destroyAll();
+        if (ctrl_) {
+            std::memset(ctrl_, swiss::kEmpty, capacity_);
+        }
+        size_ = deleted_ = 0;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity_); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void swap(flat_hash_map& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(deleted_, other.deleted_);
+    }
+
+private:
+    static constexpr size_t npos = ~size_t{0};
+
+    template <typename K>
+    size_t hashOf(const K& key) const { return swiss::mix(Hash{}(key)); }
+    static int8_t tag(size_t h) { return static_cast<int8_t>(h & 0x7f); }
+
+    value_type* slot(size_t index) { return std::launder(reinterpret_cast<value_type*>(slots_) + index); }
+    const value_type* slot(size_t index) const { return std::launder(reinterpret_cast<const value_type*>(slots_) + index); }
+
+    // Calls fn(groupStart) for each group on the probe sequence until it returns true.
+    template <typename Fn>
+    void probe(size_t h, Fn fn) const {
+        size_t groupMask = capacity_ / swiss::kGroupWidth - 1;
+        size_t group = (h >> 7) & groupMask;
+        for (size_t step = 1;; ++step) {
+            if (fn(group * swiss::kGroupWidth)) {
+                return;
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template <typename K>
+    size_t findIndex(const K& key, size_t h) const {
+        if (size_ == 0) {
+            return npos;
+        }
+        size_t result = npos;
+        probe(h, [&](size_t start) {
+            for (uint32_t m = swiss::matchByte(ctrl_ + start, tag(h)); m != 0; m &= m - 1) {
+                size_t index = start + static_cast<size_t>(__builtin_ctz(m));
+                if (Equal{}(slot(index)->first, key)) {
+                    result = index;
+                    return true;
+                }
+            }
+            return swiss::matchByte(ctrl_ + start, swiss::kEmpty) != 0;
+        });
+        return result;
+    }
+
+    size_t findInsertSlot(size_t h) const {
+        size_t result = npos;
+        probe(h, [&](size_t start) {
+            uint32_t free = swiss::matchByte(ctrl_ + start, swiss::kEmpty) | swiss::matchByte(ctrl_ + start, swiss::kDeleted);
+            if (free != 0) {
+                result = start + static_cast<size_t>(__builtin_ctz(free));
+                return true;
+            }
+            return false;
+        });
+        return result;
+    }
+
+    void rehash(size_t newCapacity) {
+        int8_t* oldCtrl = ctrl_;
+        unsigned char* oldSlots = slots_;
+        size_t oldCapacity = capacity_;
+
+        ctrl_ = static_cast<int8_t*>(::operator new(newCapacity));
+        std::memset(ctrl_, swiss::kEmpty, newCapacity);
+        slots_ = static_cast<unsigned char*>(::operator new(newCapacity * sizeof(value_type), std::align_val_t{alignof(value_type)}));
+        capacity_ = newCapacity;
+        deleted_ = 0;
+
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (oldCtrl[i] >= 0) {
+                value_type* old = std::launder(reinterpret_cast<value_type*>(oldSlots) + i);
+                size_t h = hashOf(old->first);
+                size_t index = findInsertSlot(h);
+                ctrl_[index] = tag(h);
+                new (slot(index)) value_type(std::move(const_cast<Key&>(old->first)), std::move(old->second));
+                old->~value_type();
+            }
+        }
+        ::operator delete(oldCtrl);
+        ::operator delete(oldSlots, std::align_val_t{alignof(value_type)});
+    }
+
+    void destroyAll() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] >= 0) {
+                slot(i)->~value_type();
+            }
+        }
+    }
+
+    void release() {
+        ::operator delete(ctrl_);
+        ::operator delete(slots_, std::align_val_t{alignof(value_type)});
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = 0;
+    }
+
+    int8_t* ctrl_ = nullptr;
+    unsigned char* slots_ = nullptr;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    size_t deleted_ = 0;
+};
+
+
+// --- Small-buffer-optimized vector ---
+// Stores up to N elements inline (no allocation at all for small sizes) and
+// moves to the heap only when it grows beyond that. Moving an inline
+// small_vector moves its elements; moving a heap one just steals the pointer.
+// Like std::vector, arguments may refer to elements of the vector itself
+// (v.push_back(v[0]), v.assign(v.begin() + 1, v.end())).
+template <typename T, size_t N>
+class small_vector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+
+    small_vector() = default;
+    small_vector(std::initializer_list<T> init) { append(init.begin(), init.end()); }
+    explicit small_vector(size_t count, const T& value = T()) { resize(count, value); }
+    template <typename It, typename = std::enable_if_t<!std::is_integral_v<It>>>
+    small_vector(It first, It last) { append(first, last); }
+
+    small_vector(const small_vector& other) { append(other.begin(), other.end()); }
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) { moveFrom(other); }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+    small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            freeHeap();
+            moveFrom(other);
+        }
+        return *this;
+    }
+    small_vector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    ~small_vector() {
+        clear();
+        freeHeap();
+    }
+
+    template <typename It, typename = std::enable_if_t<!std::is_integral_v<It>>>
+    void assign(It first, It last) {
+        if (empty()) {
+            append(first, last);
+            return;
+        }
+        // The range may point into *this, so read it before clearing.
+        small_vector copy(first, last);
+        *this = std::move(copy);
+    }
+    void assign(size_t count, const T& value) {
+        T copy(value);
+        clear();
+        resize(count, copy);
+    }
+    void assign(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            return reallocAppend(std::forward<Args>(args)...);
+        }
+        T* p = new (data_ + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void pop_back() { data_[--size_].~T(); }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        size_t index = static_cast<size_t>(pos - data_);
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(data_ + index, data_ + size_ - 1, data_ + size_);
+        return data_ + index;
+    }
+    iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+    iterator insert(const_iterator pos, size_t count, const T& value) {
+        size_t index = static_cast<size_t>(pos - data_);
+        size_t oldSize = size_;
+        T copy(value);
+        reserve(size_ + count);
+        for (size_t i = 0; i < count; ++i) {
+            emplace_back(copy);
+        }
+        std::rotate(data_ + index, data_ + oldSize, data_ + size_);
+        return data_ + index;
+    }
+    template <typename It, typename = std::enable_if_t<!std::is_integral_v<It>>>
+    iterator insert(const_iterator pos, It first, It last) {
+        size_t index = static_cast<size_t>(pos - data_);
+        size_t oldSize = size_;
+        // Growing would invalidate a range that points into *this.
+        small_vector items(first, last);
+        reserve(size_ + items.size());
+        for (T& item : items) {
+            emplace_back(std::move(item));
+        }
+        std::rotate(data_ + index, data_ + oldSize, data_ + size_);
+        return data_ + index;
+    }
+    iterator insert(const_iterator pos, std::initializer_list<T> init) { return insert(pos, init.begin(), init.end()); }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last) {
+        size_t index = static_cast<size_t>(first - data_);
+        size_t count = static_cast<size_t>(last - first);
+        std::move(data_ + index + count, data_ + size_, data_ + index);
+        for (size_t i = 0; i < count; ++i) {
+            pop_back();
+        }
+        return data_ + index;
+    }
+
+    void reserve(size_t n) {
+        if (n > capacity_) {
+            relocate(n);
+        }
+    }
+
+    // Returns to the inline buffer when the elements fit there again.
+    void shrink_to_fit() {
+        if (!is_inline() && size_ < capacity_) {
+            relocate(size_);
+        }
+    }
+
+    void resize(size_t n, const T& value = T()) {
+        while (size_ > n) {
+            pop_back();
+        }
+        if (size_ < n) {
+            T copy(value);
+            reserve(n);
+            while (size_ < n) {
+                emplace_back(copy);
+            }
+        }
+    }
+
+    void clear() {
+        for (size_t i = 0; i < size_; ++i) {
+            data_[i].~T();
+        }
+        size_ = 0;
+    }
+
+    void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (!is_inline() && !other.is_inline()) {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            return;
+        }
+        small_vector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+    friend void swap(small_vector& a, small_vector& b) noexcept(noexcept(a.swap(b))) { a.swap(b); }
+
+    T& operator[](size_t i) { return data_[i]; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    T& at(size_t i) {
+        if (i >= size_) {
+            throw std::out_of_range("small_vector::at");
+        }
+        return data_[i];
+    }
+    const T& at(size_t i) const { return const_cast<small_vector*>(this)->at(i); }
+    T& front() { return data_[0]; }
+    const T& front() const { return data_[0]; }
+    T& back() { return data_[size_ - 1]; }
+    const T& back() const { return data_[size_ - 1]; }
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    bool is_inline() const { return data_ == inlineData(); }
+
+    friend bool operator==(const small_vector& a, const small_vector& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+    friend bool operator!=(const small_vector& a, const small_vector& b) { return !(a == b); }
+    friend bool operator<(const small_vector& a, const small_vector& b) {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+    friend bool operator>(const small_vector& a, const small_vector& b) { return b < a; }
+    friend bool operator<=(const small_vector& a, const small_vector& b) { return !(b < a); }
+    friend bool operator>=(const small_vector& a, const small_vector& b) { return !(a < b); }
+
+private:
+    T* inlineData() { return std::launder(reinterpret_cast<T*>(inline_)); }
+    const T* inlineData() const { return std::launder(reinterpret_cast<const T*>(inline_)); }
+
+    static T* allocate(size_t capacity) {
+        return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+    static void deallocate(T* p) { ::operator delete(p, std::align_val_t{alignof(T)}); }
+
+    void moveElementsTo(T* dest) {
+        for (size_t i = 0; i < size_; ++i) {
+            new (dest + i) T(std::move_if_noexcept(data_[i]));
+            data_[i].~T();
+        }
+    }
+
+    // Moves the elements to a buffer of newCapacity (>= size_), which is the
+    // inline one when they fit.
+    void relocate(size_t newCapacity) {
+        T* dest = newCapacity <= N ? inlineData() : allocate(newCapacity);
+        if (dest == data_) {
+            return;
+        }
+        moveElementsTo(dest);
+        freeHeap();
+        data_ = dest;
+        capacity_ = dest == inlineData() ? N : newCapacity;
+    }
+
+    // emplace_back on a full vector: the new element is built in the new
+    // buffer before the old ones move out, so args may still refer to them.
+    template <typename... Args>
+    T& reallocAppend(Args&&... args) {
+        size_t newCapacity = std::max<size_t>(capacity_ * 2, 1);
+        T* fresh = allocate(newCapacity);
+        T* p;
+        try {
+            p = new (fresh + size_) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(fresh);
+            throw;
+        }
+        moveElementsTo(fresh);
+        freeHeap();
+        data_ = fresh;
+        capacity_ = newCapacity;
+        ++size_;
+        return *p;
+    }
+
+    void freeHeap() {
+        if (!is_inline()) {
+            deallocate(data_);
+            data_ = inlineData();
+            capacity_ = N;
+        }
+    }
+
+    // Expects *this to be empty and inline.
+    void moveFrom(small_vector& other) {
+        if (other.is_inline()) {
+            for (size_t i = 0; i < other.size_; ++i) {
+                new (data_ + i) T(std::move(other.data_[i]));
+            }
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    // Copies into an empty vector; the source cannot alias it.
+    template <typename It>
+    void append(It first, It last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+    T* data_ = inlineData();
+    size_t size_ = 0;
+    size_t capacity_ = N;
+};
+
+
+// --- Radix and parallel sort ---
+// LSD radix sort: one counting pass per key byte, ping-ponging between the
+// input and a scratch buffer. Keys are mapped to unsigned integers whose order
+// matches the original type (sign bit flipped for signed, IEEE trick for
+// floats), and passes whose byte is identical for every key are skipped.
+template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+std::make_unsigned_t<T> radixKey(T v) {
+    using Key = std::make_unsigned_t<T>;
+    if constexpr (std::is_signed_v<T>) {
+        return static_cast<Key>(static_cast<Key>(v) ^ (Key{1} << (sizeof(T) * 8 - 1)));
+    } else {
+        return v;
+    }
+}
+inline uint32_t radixKey(float v) {
+    uint32_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+inline uint64_t radixKey(double v) {
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : bits | 0x8000000000000000ull;
+}
+
+// Sorts records by keyOf(record), which must return an integer, float or double. Stable.
+template <typename T, typename KeyOf>
+void radixSortBy(std::vector<T>& data, KeyOf keyOf) {
+    using Key = decltype(radixKey(keyOf(data[0])));
+    constexpr size_t kPasses = sizeof(Key);
+    const size_t n = data.size();
+    if (n < 2) {
+        return;
+    }
+
+    // All histograms in one read of the input.
+    std::vector<std::array<size_t, 256>> counts(kPasses);
+    for (auto& c : counts) {
+        c.fill(0);
+    }
+    for (const T& item : data) {
+        Key k = radixKey(keyOf(item));
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            ++counts[pass][(k >> (pass * 8)) & 0xff];
+        }
+    }
+
+    std::vector<T> scratch(n);
+    T* src = data.data();
+    T* dst = scratch.data();
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+        std::array<size_t, 256>& c = counts[pass];
+        if (c[(radixKey(keyOf(src[0])) >> (pass * 8)) & 0xff] == n) {
+            continue; // every key has the same byte here
+        }
+        size_t offset = 0;
+        for (size_t& bucket : c) {
+            size_t count = bucket;
+            bucket = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            Key k = radixKey(keyOf(src[i]));
+            dst[c[(k >> (pass * 8)) & 0xff]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data.data()) {
+        std::move(src, src + n, data.data());
+    }
+}
+
+template <typename T>
+void radixSort(std::vector<T>& data) {
+    radixSortBy(data, [](const T& v) { return v; });
+}
+
+// Fixed-size pool of worker threads fed from one task queue.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency())) {
+        for (unsigned i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& w : workers_) {
+            w.join();
+        }
+    }
+
+    template <typename Fn>
+    std::future<void> submit(Fn fn) {
+        auto task = std::make_shared<std::packaged_task<void()>>(std::move(fn));
+        std::future<void> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            tasks_.emplace_back([task] { (*task)(); });
+        }
+        cv_.notify_one();
+        return result;
+    }
+
+    size_t size() const { return workers_.size(); }
+
+private:
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_ && tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
+
+// Parallel merge sort for any comparator: the range is cut into one run per
+// worker, runs are std::sort-ed concurrently, then merged pairwise in rounds
+// (each round's merges also run concurrently) between data and a scratch buffer.
+template <typename T, typename Compare = std::less<T>>
+void parallelSort(std::vector<T>& data, ThreadPool& pool, Compare comp = Compare()) {
+    const size_t n = data.size();
+    size_t runs = std::min<size_t>(pool.size(), n / 4096 + 1);
+    if (runs <= 1) {
+        std::sort(data.begin(), data.end(), comp);
+        return;
+    }
+
+    std::vector<size_t> bounds(runs + 1);
+    for (size_t i = 0; i <= runs; ++i) {
+        bounds[i] = n * i / runs;
+    }
+    std::vector<std::future<void>> pending;
+    for (size_t i = 0; i < runs; ++i) {
+        pending.push_back(pool.submit([&, i] {
+            std::sort(data.begin() + static_cast<std::ptrdiff_t>(bounds[i]), data.begin() + static_cast<std::ptrdiff_t>(bounds[i + 1]), comp);
+        }));
+    }
+    for (auto& f : pending) {
+        f.get();
+    }
+
+    std::vector<T> scratch(n);
+    T* src = data.data();
+    T* dst = scratch.data();
+    while (bounds.size() > 2) {
+        std::vector<size_t> merged;
+        pending.clear();
+        for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+            size_t lo = bounds[i];
+            size_t mid = bounds[i + 1];
+            size_t hi = (i + 2 < bounds.size()) ? bounds[i + 2] : mid;
+            merged.push_back(lo);
+            pending.push_back(pool.submit([=, &comp] {
+                std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+                           std::make_move_iterator(src + mid), std::make_move_iterator(src + hi), dst + lo, comp);
+            }));
+        }
+        merged.push_back(n);
+        for (auto& f : pending) {
+            f.get();
+        }
+        bounds.swap(merged);
+        std::swap(src, dst);
+    }
+    if (src != data.data()) {
+        std::move(src, src + n, data.data());
+    }
+}
+
+
+// --- Intrusive list with slab-pooled nodes ---
+// The links live inside the element (by deriving from IntrusiveListHook), so
+// linking allocates nothing and any element can be unlinked in O(1) given only
+// a reference to it. A Tag lets one object sit in several lists at once.
+// Elements come from a SlabPool: slabs of many objects carved into a free list,
+// so creating and destroying nodes recycles memory instead of calling malloc.
+template <typename Tag = void>
+struct IntrusiveListHook {
+    IntrusiveListHook* prev = nullptr;
+    IntrusiveListHook* next = nullptr;
+    bool is_linked() const { return next != nullptr; }
+};
+
+template <typename T, typename Tag = void>
+class intrusive_list {
+    using Hook = IntrusiveListHook<Tag>;
+
+public:
+    class iterator {
+    public:
+        explicit iterator(Hook* h) : h_(h) {}
+        T& operator*() const { return static_cast<T&>(*h_); }
+        T* operator->() const { return static_cast<T*>(h_); }
+        iterator& operator++() {
+            h_ = h_->next;
+            return *this;
+        }
+        bool operator==(const iterator& o) const { return h_ == o.h_; }
+        bool operator!=(const iterator& o) const { return h_ != o.h_; }
+
+    private:
+        Hook* h_;
+    };
+
+    intrusive_list() { head_.prev = head_.next = &head_; }
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+    ~intrusive_list() { clear(); }
+
+    void push_front(T& item) { linkAfter(&head_, hookOf(item)); }
+    void push_back(T& item) { linkAfter(head_.prev, hookOf(item)); }
+
+    // O(1): no search, the element knows its neighbours.
+    void remove(T& item) {
+        Hook* h = hookOf(item);
+        h->prev->next = h->next;
+        h->next->prev = h->prev;
+        h->prev = h->next = nullptr;
+        --size_;
+    }
+
+    void move_to_front(T& item) {
+        remove(item);
+        push_front(item);
+    }
+
+    T& front() { return static_cast<T&>(*head_.next); }
+    T& back() { return static_cast<T&>(*head_.prev); }
+    T& pop_back() {
+        T& item = back();
+        remove(item);
+        return item;
+    }
+
+    // Unlinks everything; the elements themselves are owned elsewhere.
+    void clear() {
+        while (!empty()) {
+            remove(front());
+        }
+    }
+
+    iterator begin() { return iterator(head_.next); }
+    iterator end() { return iterator(&head_); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    static Hook* hookOf(T& item) { return static_cast<Hook*>(&item); }
+
+    void linkAfter(Hook* pos, Hook* h) {
+        h->prev = pos;
+        h->next = pos->next;
+        pos->next->prev = h;
+        pos->next = h;
+        ++size_;
+    }
+
+    Hook head_;
+    size_t size_ = 0;
+};
+
+// Fixed-size object pool backed by slabs of kSlabSize objects. Not thread-safe.
+template <typename T, size_t kSlabSize = 256>
+class SlabPool {
+public:
+    SlabPool() = default;
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+    ~SlabPool() {
+        for (Slot* slab : slabs_) {
+            ::operator delete(slab, std::align_val_t{alignof(Slot)});
+        }
+    }
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (!free_) {
+            addSlab();
+        }
+        Slot* slot = free_;
+        free_ = slot->next;
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* obj) {
+        obj->~T();
+        Slot* slot = reinterpret_cast<Slot*>(obj);
+        slot->next = free_;
+        free_ = slot;
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void addSlab() {
+        Slot* slab = static_cast<Slot*>(::operator new(kSlabSize * sizeof(Slot), std::align_val_t{alignof(Slot)}));
+        for (size_t i = 0; i < kSlabSize; ++i) {
+            slab[i].next = (i + 1 < kSlabSize) ? &slab[i + 1] : free_;
+        }
+        free_ = slab;
+        slabs_.push_back(slab);
+    }
+
+    std::vector<Slot*> slabs_;
+    Slot* free_ = nullptr;
+};
+
+
+// --- Integer set structures ---
+// DynamicBitset: one bit per possible value. Set operations are word-wise
+// AND/OR/ANDNOT over the whole array (AVX2 when available) and counting uses
+// a vectorized popcount, so cost depends on the universe size, not on the
+// number of elements.
+class DynamicBitset {
+public:
+    DynamicBitset() = default;
+    explicit DynamicBitset(size_t bits) : bits_(bits), words_((bits + 63) / 64, 0) {}
+
+    void set(size_t i) { words_[i >> 6] |= uint64_t{1} << (i & 63); }
+    void reset(size_t i) { words_[i >> 6] &= ~(uint64_t{1} << (i & 63)); }
+    bool test(size_t i) const { return i < bits_ && (words_[i >> 6] >> (i & 63)) & 1; }
+    size_t size() const { return bits_; }
+
+    // Operands must have the same size.
+    DynamicBitset& operator&=(const DynamicBitset& o) { return apply(o, Op::And); }
+    DynamicBitset& operator|=(const DynamicBitset& o) { return apply(o, Op::Or); }
+    DynamicBitset& andNot(const DynamicBitset& o) { return apply(o, Op::AndNot); }
+
+    size_t count() const { return popcount(words_.data(), words_.size()); }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            for (uint64_t bits = words_[w]; bits != 0; bits &= bits - 1) {
+                fn(static_cast<uint32_t>(w * 64 + static_cast<size_t>(__builtin_ctzll(bits))));
+            }
+        }
+    }
+
+    static size_t popcount(const uint64_t* words, size_t n) {
+        size_t total = 0, i = 0;
+#if defined(__AVX2__)
+        // Nibble lookup table via vpshufb, summed per 64-bit lane with vpsadbw.
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowMask = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+            __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, lowMask));
+            __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+        }
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        total = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#endif
+        for (; i < n; ++i) {
+            total += static_cast<size_t>(__builtin_popcountll(words[i]));
+        }
+        return total;
+    }
+
+private:
+    enum class Op { And, Or, AndNot };
+
+    DynamicBitset& apply(const DynamicBitset& o, Op op) {
+        uint64_t* a = words_.data();
+        const uint64_t* b = o.words_.data();
+        const size_t n = std::min(words_.size(), o.words_.size());
+        size_t vectorEnd = 0;
+#if defined(__AVX2__)
+        vectorEnd = n & ~size_t{3};
+        for (size_t i = 0; i < vectorEnd; i += 4) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            __m256i r = op == Op::And ? _mm256_and_si256(x, y) : op == Op::Or ? _mm256_or_si256(x, y) : _mm256_andnot_si256(y, x);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), r);
+        }
+#endif
+        for (size_t i = vectorEnd; i < n; ++i) {
+            a[i] = op == Op::And ? a[i] & b[i] : op == Op::Or ? a[i] | b[i] : a[i] & ~b[i];
+        }
+        return *this;
+    }
+
+    size_t bits_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+// RoaringSet: compressed set of uint32_t. Values are grouped by their high 16
+// bits into chunks of 65536; each chunk is stored in whichever container is
+// smallest for its contents:
+//   array  - sorted uint16_t low halves, up to 4096 of them
+//   bitmap - 65536 bits (8 KB), for dense chunks
+//   run    - sorted (start, length-1) pairs, after runOptimize(), for long runs
+// Intersection and union work chunk by chunk and only touch chunks present in
+// both (or either) sets, with a specialised routine per container pair.
+class RoaringSet {
+public:
+    void add(uint32_t v) {
+        Container& c = containerFor(static_cast<uint16_t>(v >> 16));
+        c.add(static_cast<uint16_t>(v));
+    }
+
+    bool contains(uint32_t v) const {
+        auto it = std::lower_bound(keys_.begin(), keys_.end(), static_cast<uint16_t>(v >> 16));
+        if (it == keys_.end() || *it != static_cast<uint16_t>(v >> 16)) {
+            return false;
+        }
+        return containers_[static_cast<size_t>(it - keys_.begin())].contains(static_cast<uint16_t>(v));
+    }
+
+    size_t cardinality() const {
+        size_t total = 0;
+        for (const Container& c : containers_) {
+            total += c.cardinality;
+        }
+        return total;
+    }
+
+    // Converts chunks to run containers wherever that is the smaller encoding.
+    void runOptimize() {
+        for (Container& c : containers_) {
+            c.runOptimize();
+        }
+    }
+
+    size_t sizeInBytes() const {
+        size_t total = keys_.size() * sizeof(uint16_t);
+        for (const Container& c : containers_) {
+            total += c.bytes();
+        }
+        return total;
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            uint32_t high = static_cast<uint32_t>(keys_[i]) << 16;
+            containers_[i].forEach([&](uint16_t low) { fn(high | low); });
+        }
+    }
+
+    friend RoaringSet operator&(const RoaringSet& a, const RoaringSet& b) {
+        RoaringSet out;
+        size_t i = 0, j = 0;
+        while (i < a.keys_.size() && j < b.keys_.size()) {
+            if (a.keys_[i] < b.keys_[j]) {
+                ++i;
+            } else if (b.keys_[j] < a.keys_[i]) {
+                ++j;
+            } else {
+                Container c = Container::intersect(a.containers_[i], b.containers_[j]);
+                if (c.cardinality > 0) {
+                    out.keys_.push_back(a.keys_[i]);
+                    out.containers_.push_back(std::move(c));
+                }
+                ++i;
+                ++j;
+            }
+        }
+        return out;
+    }
+
+    friend RoaringSet operator|(const RoaringSet& a, const RoaringSet& b) {
+        RoaringSet out;
+        size_t i = 0, j = 0;
+        while (i < a.keys_.size() || j < b.keys_.size()) {
+            if (j == b.keys_.size() || (i < a.keys_.size() && a.keys_[i] < b.keys_[j])) {
+                out.keys_.push_back(a.keys_[i]);
+                out.containers_.push_back(a.containers_[i++]);
+            } else if (i == a.keys_.size() || b.keys_[j] < a.keys_[i]) {
+                out.keys_.push_back(b.keys_[j]);
+                out.containers_.push_back(b.containers_[j++]);
+            } else {
+                out.keys_.push_back(a.keys_[i]);
+                out.containers_.push_back(Container::unite(a.containers_[i++], b.containers_[j++]));
+            }
+        }
+        return out;
+    }
+
+private:
+    static constexpr uint32_t kArrayMax = 4096;
+    static constexpr size_t kBitmapWords = 1024;
+
+    struct Run {
+        uint16_t start;
+        uint16_t lengthMinusOne;
+    };
+
+    enum class Kind : uint8_t { Array, Bitmap, Run };
+
+    struct Container {
+        Kind kind = Kind::Array;
+        uint32_t cardinality = 0;
+        std::vector<uint16_t> array;
+        std::vector<uint64_t> bitmap;
+        std::vector<Run> runs;
+
+        bool contains(uint16_t v) const {
+            switch (kind) {
+            case Kind::Array:
+                return std::binary_search(array.begin(), array.end(), v);
+            case Kind::Bitmap:
+                return (bitmap[v >> 6] >> (v & 63)) & 1;
+            case Kind::Run: {
+                auto it = std::upper_bound(runs.begin(), runs.end(), v, [](uint16_t x, const Run& r) { return x < r.start; });
+                if (it == runs.begin()) {
+                    return false;
+                }
+                --it;
+                return v - it->start <= it->lengthMinusOne;
+            }
+            }
+            return false;
+        }
+
+        void add(uint16_t v) {
+            if (kind == Kind::Run) {
+                toBitmap();
+            }
+            if (kind == Kind::Array) {
+                auto it = std::lower_bound(array.begin(), array.end(), v);
+                if (it != array.end() && *it == v) {
+                    return;
+                }
+                array.insert(it, v);
+                if (++cardinality > kArrayMax) {
+                    toBitmap();
+                }
+            } else {
+                uint64_t bit = uint64_t{1} << (v & 63);
+                if (!(bitmap[v >> 6] & bit)) {
+                    bitmap[v >> 6] |= bit;
+                    ++cardinality;
+                }
+            }
+        }
+
+        template <typename Fn>
+        void forEach(Fn fn) const {
+            switch (kind) {
+            case Kind::Array:
+                for (uint16_t v : array) fn(v);
+                break;
+            case Kind::Bitmap:
+                for (size_t w = 0; w < kBitmapWords; ++w) {
+                    for (uint64_t bits = bitmap[w]; bits != 0; bits &= bits - 1) {
+                        fn(static_cast<uint16_t>(w * 64 + static_cast<size_t>(__builtin_ctzll(bits))));
+                    }
+                }
+                break;
+            case Kind::Run:
+                for (const Run& r : runs) {
+                    for (uint32_t v = r.start; v <= static_cast<uint32_t>(r.start) + r.lengthMinusOne; ++v) fn(static_cast<uint16_t>(v));
+                }
+                break;
+            }
+        }
+
+        // Sets bits [first, last] of a bitmap a word at a time.
+        static void setRange(uint64_t* bits, uint32_t first, uint32_t last) {
+            uint32_t fw = first >> 6, lw = last >> 6;
+            uint64_t firstMask = ~uint64_t{0} << (first & 63);
+            uint64_t lastMask = ~uint64_t{0} >> (63 - (last & 63));
+            if (fw == lw) {
+                bits[fw] |= firstMask & lastMask;
+                return;
+            }
+            bits[fw] |= firstMask;
+            for (uint32_t w = fw + 1; w < lw; ++w) bits[w] = ~uint64_t{0};
+            bits[lw] |= lastMask;
+        }
+
+        void toBitmap() {
+            std::vector<uint64_t> bits(kBitmapWords, 0);
+            if (kind == Kind::Run) {
+                for (const Run& r : runs) setRange(bits.data(), r.start, static_cast<uint32_t>(r.start) + r.lengthMinusOne);
+            } else {
+                forEach([&](uint16_t v) { bits[v >> 6] |= uint64_t{1} << (v & 63); });
+            }
+            bitmap.swap(bits);
+            array.clear();
+            array.shrink_to_fit();
+            runs.clear();
+            runs.shrink_to_fit();
+            kind = Kind::Bitmap;
+        }
+
+        void toArray() {
+            std::vector<uint16_t> values;
+            values.reserve(cardinality);
+            forEach([&](uint16_t v) { values.push_back(v); });
+            array.swap(values);
+            bitmap.clear();
+            bitmap.shrink_to_fit();
+            runs.clear();
+            runs.shrink_to_fit();
+            kind = Kind::Array;
+        }
+
+        // Array if small enough, bitmap otherwise.
+        void normalize() {
+            if (kind == Kind::Bitmap && cardinality <= kArrayMax) {
+                toArray();
+            } else if (kind == Kind::Array && cardinality > kArrayMax) {
+                toBitmap();
+            }
+        }
+
+        void runOptimize() {
+            std::vector<Run> found;
+            forEach([&](uint16_t v) {
+                if (!found.empty() && static_cast<uint32_t>(found.back().start) + found.back().lengthMinusOne + 1 == v) {
+                    ++found.back().lengthMinusOne;
+                } else {
+                    found.push_back({v, 0});
+                }
+            });
+            if (found.size() * sizeof(Run) < bytes()) {
+                runs.swap(found);
+                array.clear();
+                array.shrink_to_fit();
+                bitmap.clear();
+                bitmap.shrink_to_fit();
+                kind = Kind::Run;
+            }
+        }
+
+        size_t bytes() const {
+            switch (kind) {
+            case Kind::Array: return array.size() * sizeof(uint16_t);
+            case Kind::Bitmap: return kBitmapWords * sizeof(uint64_t);
+            case Kind::Run: return runs.size() * sizeof(Run);
+            }
+            return 0;
+        }
+
+        // Run containers take part in set operations through a temporary array/bitmap.
+        static const Container& operand(const Container& c, Container& scratch) {
+            if (c.kind != Kind::Run) {
+                return c;
+            }
+            scratch = c;
+            scratch.toBitmap();
+            scratch.normalize();
+            return scratch;
+        }
+
+        static Container intersect(const Container& a0, const Container& b0) {
+            Container sa, sb, out;
+            if ((a0.kind == Kind::Run) != (b0.kind == Kind::Run) && (a0.kind == Kind::Array || b0.kind == Kind::Array)) {
+                // Run against array: one merge pass, no conversion.
+                const Container& r = a0.kind == Kind::Run ? a0 : b0;
+                const Container& arr = a0.kind == Kind::Run ? b0 : a0;
+                auto run = r.runs.begin();
+                for (uint16_t v : arr.array) {
+                    while (run != r.runs.end() && static_cast<uint32_t>(run->start) + run->lengthMinusOne < v) ++run;
+                    if (run == r.runs.end()) break;
+                    if (v >= run->start) out.array.push_back(v);
+                }
+                out.cardinality = static_cast<uint32_t>(out.array.size());
+                return out;
+            }
+            const Container& a = operand(a0, sa);
+            const Container& b = operand(b0, sb);
+            if (a.kind == Kind::Bitmap && b.kind == Kind::Bitmap) {
+                out.kind = Kind::Bitmap;
+                out.bitmap.resize(kBitmapWords);
+                for (size_t w = 0; w < kBitmapWords; ++w) {
+                    out.bitmap[w] = a.bitmap[w] & b.bitmap[w];
+                }
+                out.cardinality = static_cast<uint32_t>(DynamicBitset::popcount(out.bitmap.data(), kBitmapWords));
+                out.normalize();
+            } else if (a.kind == Kind::Array && b.kind == Kind::Array) {
+                std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(out.array));
+                out.cardinality = static_cast<uint32_t>(out.array.size());
+            } else {
+                const Container& arr = a.kind == Kind::Array ? a : b;
+                const Container& bits = a.kind == Kind::Array ? b : a;
+                for (uint16_t v : arr.array) {
+                    if ((bits.bitmap[v >> 6] >> (v & 63)) & 1) out.array.push_back(v);
+                }
+                out.cardinality = static_cast<uint32_t>(out.array.size());
+            }
+            return out;
+        }
+
+        static Container unite(const Container& a0, const Container& b0) {
+            Container sa, sb, out;
+            const Container& a = operand(a0, sa);
+            const Container& b = operand(b0, sb);
+            if (a.kind == Kind::Array && b.kind == Kind::Array) {
+                std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(out.array));
+                out.cardinality = static_cast<uint32_t>(out.array.size());
+                out.normalize();
+                return out;
+            }
+            out.kind = Kind::Bitmap;
+            out.bitmap.assign(kBitmapWords, 0);
+            for (const Container* c : {&a, &b}) {
+                if (c->kind == Kind::Bitmap) {
+                    for (size_t w = 0; w < kBitmapWords; ++w) out.bitmap[w] |= c->bitmap[w];
+                } else {
+                    for (uint16_t v : c->array) out.bitmap[v >> 6] |= uint64_t{1} << (v & 63);
+                }
+            }
+            out.cardinality = static_cast<uint32_t>(DynamicBitset::popcount(out.bitmap.data(), kBitmapWords));
+            return out;
+        }
+    };
+
+    Container& containerFor(uint16_t key) {
+        auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+        size_t index = static_cast<size_t>(it - keys_.begin());
+        if (it == keys_.end() || *it != key) {
+            keys_.insert(it, key);
+            containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(index), Container());
+        }
+        return containers_[index];
+    }
+
+    std::vector<uint16_t> keys_;
+    std::vector<Container> containers_;
+};
+
 
 
 void containerExamples() {
@@ -103,10 +1702,414 @@ void algorithmExamples() {
     std::cout << std::endl;
 }
 
+
+// Runs fn once and returns the wall time in milliseconds.
+template <typename Fn>
+double benchmarkMs(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void flatContainerExamples() {
+    std::cout << "\n--- Flat Containers ---" << std::endl;
+
+    flat_map<std::string, int> ages = {{"Alice", 30}, {"Bob", 25}};
+    ages["Carol"] = 41;
+    std::cout << "Bob's age is: " << ages.find("Bob")->second << std::endl;
+
+    flat_set<int> unique_numbers = {10, 5, 10};
+    unique_numbers.insert(7);
+    std::cout << "Flat set elements: ";
+    for (int n : unique_numbers) {
+        std::cout << n << " ";
+    }
+    std::cout << std::endl;
+
+    // Benchmark: bulk load then random lookups, half of them misses.
+    const size_t n = 1000000;
+    const size_t lookups = 2000000;
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> keys(n);
+    for (auto& k : keys) {
+        k = rng() & ~uint64_t{1}; // even keys, so odd probes always miss
+    }
+    std::vector<uint64_t> probes(lookups);
+    for (size_t i = 0; i < lookups; ++i) {
+        probes[i] = (i % 2 == 0) ? keys[rng() % n] : (rng() | 1);
+    }
+
+    std::set<uint64_t> treeSet;
+    flat_set<uint64_t> flatSet;
+    double treeInsert = benchmarkMs([&] { treeSet.insert(keys.begin(), keys.end()); });
+    double flatInsert = benchmarkMs([&] { flatSet.insert_bulk(keys.begin(), keys.end()); });
+    EytzingerIndex<uint64_t> eytzinger(flatSet.values());
+
+    size_t hits[4] = {};
+    double treeFind = benchmarkMs([&] { for (uint64_t p : probes) hits[0] += treeSet.count(p); });
+    double stdLowerBound = benchmarkMs([&] {
+        const auto& v = flatSet.values();
+        for (uint64_t p : probes) {
+            auto it = std::lower_bound(v.begin(), v.end(), p);
+            hits[1] += (it != v.end() && *it == p);
+        }
+    });
+    double branchless = benchmarkMs([&] { for (uint64_t p : probes) hits[2] += flatSet.contains(p); });
+    double eytz = benchmarkMs([&] { for (uint64_t p : probes) hits[3] += eytzinger.contains(p); });
+
+    std::cout << n << " keys, insert: std::set " << treeInsert << " ms, flat_set bulk " << flatInsert << " ms" << std::endl;
+    std::cout << lookups << " lookups: std::set " << treeFind << " ms, std::lower_bound " << stdLowerBound
+              << " ms, branchless " << branchless << " ms, Eytzinger " << eytz << " ms (hits "
+              << hits[0] << "/" << hits[1] << "/" << hits[2] << "/" << hits[3] << ")" << std::endl;
+
+    std::map<std::string, int> treeMap;
+    flat_map<std::string, int> flatMap;
+    std::vector<std::pair<std::string, int>> symbols;
+    for (int i = 0; i < 100000; ++i) {
+        symbols.emplace_back("symbol_" + std::to_string(rng() % 1000000), i);
+    }
+    double treeMapInsert = benchmarkMs([&] { treeMap.insert(symbols.begin(), symbols.end()); });
+    double flatMapInsert = benchmarkMs([&] { flatMap.insert_bulk(symbols.begin(), symbols.end()); });
+    long long sums[2] = {};
+    double treeMapFind = benchmarkMs([&] { for (const auto& s : symbols) sums[0] += treeMap.find(s.first)->second; });
+    double flatMapFind = benchmarkMs([&] { for (const auto& s : symbols) sums[1] += flatMap.find(s.first)->second; });
+    std::cout << symbols.size() << " string keys: std::map insert " << treeMapInsert << " ms / find " << treeMapFind
+              << " ms, flat_map bulk insert " << flatMapInsert << " ms / find " << flatMapFind << " ms (sums "
+              << sums[0] << "/" << sums[1] << ")" << std::endl;
+}
+
+void hashMapExamples() {
+    std::cout << "\n--- Open-Addressing Hash Map ---" << std::endl;
+
+    flat_hash_map<std::string, int> ages = {{"Alice", 30}, {"Bob", 25}};
+    std::string_view bob = "Bob";
+    std::cout << "Bob's age is: " << ages.find(bob)->second << " (looked up by string_view)" << std::endl;
+
+    // Benchmark: insert, hit, miss, erase and iterate on integer and string keys.
+    const size_t n = 500000;
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> keys(n), misses(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = rng() & ~uint64_t{1};
+        misses[i] = rng() | 1;
+    }
+    std::vector<std::string> strKeys(n);
+    for (size_t i = 0; i < n; ++i) {
+        strKeys[i] = "user:" + std::to_string(keys[i]);
+    }
+
+    auto run = [&](const char* name, auto& intMap, auto& strMap) {
+        uint64_t sum = 0;
+        double insert = benchmarkMs([&] {
+            for (size_t i = 0; i < n; ++i) intMap[keys[i]] = i;
+        });
+        double hit = benchmarkMs([&] {
+            for (uint64_t k : keys) sum += intMap.find(k)->second;
+        });
+        double miss = benchmarkMs([&] {
+            for (uint64_t k : misses) sum += intMap.find(k) == intMap.end();
+        });
+        double iterate = benchmarkMs([&] {
+            for (const auto& kv : intMap) sum += kv.second;
+        });
+        double erase = benchmarkMs([&] {
+            for (size_t i = 0; i < n; i += 2) intMap.erase(keys[i]);
+        });
+        double strInsert = benchmarkMs([&] {
+            for (size_t i = 0; i < n; ++i) strMap[strKeys[i]] = i;
+        });
+        double strHit = benchmarkMs([&] {
+            for (const auto& k : strKeys) sum += strMap.find(k)->second;
+        });
+        std::cout << name << ": insert " << insert << ", hit " << hit << ", miss " << miss << ", iterate " << iterate
+                  << ", erase " << erase << ", string insert " << strInsert << ", string hit " << strHit
+                  << " ms (checksum " << sum << ")" << std::endl;
+    };
+
+    std::cout << n << " keys, group width " << swiss::kGroupWidth << " (times in ms)" << std::endl;
+    {
+        std::map<uint64_t, size_t> intMap;
+        std::map<std::string, size_t> strMap;
+        run("std::map          ", intMap, strMap);
+    }
+    {
+        std::unordered_map<uint64_t, size_t> intMap;
+        std::unordered_map<std::string, size_t> strMap;
+        run("std::unordered_map", intMap, strMap);
+    }
+    {
+        flat_hash_map<uint64_t, size_t> intMap;
+        flat_hash_map<std::string, size_t> strMap;
+        run("flat_hash_map     ", intMap, strMap);
+    }
+}
+
+void smallVectorExamples() {
+    std::cout << "\n--- Small Vector ---" << std::endl;
+    small_vector<int, 8> vec = {1, 2, 3, 4, 5};
+    vec.push_back(6);
+    std::cout << "small_vector elements: ";
+    for (int i : vec) {
+        std::cout << i << " ";
+    }
+    std::cout << "(inline: " << (vec.is_inline() ? "yes" : "no") << ")" << std::endl;
+    for (int i = 7; i <= 12; ++i) {
+        vec.push_back(i);
+    }
+    std::cout << "After growing to " << vec.size() << " elements, inline: " << (vec.is_inline() ? "yes" : "no") << std::endl;
+
+    // Benchmark: per-request vectors that almost always stay tiny.
+    const int requests = 2000000;
+    std::mt19937 rng(11);
+    std::vector<int> sizes(requests);
+    for (int& n : sizes) {
+        n = (rng() % 100 == 0) ? 32 : static_cast<int>(rng() % 12); // 1% spill past the inline capacity
+    }
+    long long sum = 0;
+    double heap = benchmarkMs([&] {
+        for (int n : sizes) {
+            std::vector<int> ids;
+            for (int i = 0; i < n; ++i) ids.push_back(i);
+            sum += static_cast<long long>(ids.size());
+        }
+    });
+    double small = benchmarkMs([&] {
+        for (int n : sizes) {
+            small_vector<int, 12> ids;
+            for (int i = 0; i < n; ++i) ids.push_back(i);
+            sum += static_cast<long long>(ids.size());
+        }
+    });
+    std::cout << requests << " short-lived collections: std::vector " << heap << " ms, small_vector<int, 12> "
+              << small << " ms (checksum " << sum << ")" << std::endl;
+}
+
+void sortingExamples() {
+    std::cout << "\n--- Radix and Parallel Sort ---" << std::endl;
+    std::vector<int> data = {5, -2, 8, 1, -9, 4};
+    radixSort(data);
+    std::cout << "Radix-sorted vector: ";
+    for (int n : data) {
+        std::cout << n << " ";
+    }
+    std::cout << std::endl;
+
+    std::vector<std::pair<float, std::string>> scored = {{0.5f, "b"}, {-1.25f, "a"}, {3.0f, "c"}};
+    radixSortBy(scored, [](const std::pair<float, std::string>& p) { return p.first; });
+    std::cout << "Key-value pairs sorted by float key: ";
+    for (const auto& [score, name] : scored) {
+        std::cout << name << "=" << score << " ";
+    }
+    std::cout << std::endl;
+
+    // Sweep from 1K elements up; raise kMaxElements (memory permitting, 1B
+    // uint64_t needs 16 GB with the scratch buffer) for the full range.
+    const size_t kMaxElements = 10000000;
+    ThreadPool pool;
+    std::mt19937_64 rng(2024);
+    std::cout << "uint64_t keys, " << pool.size() << " worker(s), times in ms" << std::endl;
+    for (size_t n = 1000; n <= kMaxElements; n *= 10) {
+        std::vector<uint64_t> input(n);
+        for (auto& v : input) {
+            v = rng();
+        }
+        std::vector<uint64_t> work;
+        auto timeSort = [&](auto sorter) {
+            work = input;
+            double ms = benchmarkMs([&] { sorter(work); });
+            if (!std::is_sorted(work.begin(), work.end())) {
+                std::cerr << "Error: output not sorted" << std::endl;
+            }
+            return ms;
+        };
+        double stdSort = timeSort([](std::vector<uint64_t>& v) { std::sort(v.begin(), v.end()); });
+#ifdef WITH_PARALLEL_STL
+        double parSort = timeSort([](std::vector<uint64_t>& v) { std::sort(std::execution::par, v.begin(), v.end()); });
+#endif
+        double radix = timeSort([](std::vector<uint64_t>& v) { radixSort(v); });
+        double parallel = timeSort([&pool](std::vector<uint64_t>& v) { parallelSort(v, pool); });
+        std::cout << "n=" << n << ": std::sort " << stdSort
+#ifdef WITH_PARALLEL_STL
+                  << ", std::sort(par) " << parSort
+#endif
+                  << ", radix " << radix << ", parallel merge " << parallel << std::endl;
+    }
+}
+
+void intrusiveListExamples() {
+    std::cout << "\n--- Intrusive List ---" << std::endl;
+    struct Fruit : IntrusiveListHook<> {
+        explicit Fruit(std::string n) : name(std::move(n)) {}
+        std::string name;
+    };
+    SlabPool<Fruit> fruits;
+    intrusive_list<Fruit> str_list;
+    Fruit* apple = fruits.create("apple");
+    str_list.push_back(*apple);
+    str_list.push_back(*fruits.create("banana"));
+    str_list.push_front(*fruits.create("orange"));
+    std::cout << "List elements: ";
+    for (const auto& f : str_list) {
+        std::cout << f.name << " ";
+    }
+    str_list.move_to_front(*apple);
+    std::cout << "| after moving apple to front: ";
+    for (const auto& f : str_list) {
+        std::cout << f.name << " ";
+    }
+    std::cout << std::endl;
+    while (!str_list.empty()) {
+        fruits.destroy(&str_list.pop_back());
+    }
+
+    // Benchmark: LRU cache, hit -> move to front, miss -> evict the back entry.
+    const size_t capacity = 10000;
+    const size_t accesses = 3000000;
+    std::mt19937 rng(3);
+    std::vector<uint32_t> keys(accesses);
+    for (auto& k : keys) {
+        k = (rng() % 4 == 0) ? rng() % 100000 : rng() % (capacity / 2); // hot set plus a cold tail
+    }
+
+    size_t stdHits = 0;
+    double stdTime = benchmarkMs([&] {
+        std::list<std::pair<uint32_t, std::string>> lru;
+        std::unordered_map<uint32_t, std::list<std::pair<uint32_t, std::string>>::iterator> index;
+        for (uint32_t k : keys) {
+            auto it = index.find(k);
+            if (it != index.end()) {
+                lru.splice(lru.begin(), lru, it->second);
+                ++stdHits;
+                continue;
+            }
+            if (lru.size() == capacity) {
+                index.erase(lru.back().first);
+                lru.pop_back();
+            }
+            lru.emplace_front(k, "value");
+            index[k] = lru.begin();
+        }
+    });
+
+    struct Entry : IntrusiveListHook<> {
+        Entry(uint32_t k, const char* v) : key(k), value(v) {}
+        uint32_t key;
+        std::string value;
+    };
+    size_t intrusiveHits = 0;
+    double intrusiveTime = benchmarkMs([&] {
+        SlabPool<Entry> pool;
+        intrusive_list<Entry> lru;
+        std::unordered_map<uint32_t, Entry*> index;
+        for (uint32_t k : keys) {
+            auto it = index.find(k);
+            if (it != index.end()) {
+                lru.move_to_front(*it->second);
+                ++intrusiveHits;
+                continue;
+            }
+            if (lru.size() == capacity) {
+                Entry& victim = lru.pop_back();
+                index.erase(victim.key);
+                pool.destroy(&victim);
+            }
+            Entry* e = pool.create(k, "value");
+            lru.push_front(*e);
+            index[k] = e;
+        }
+        while (!lru.empty()) {
+            pool.destroy(&lru.pop_back());
+        }
+    });
+    std::cout << accesses << " LRU accesses (capacity " << capacity << "): std::list " << stdTime << " ms, intrusive list "
+              << intrusiveTime << " ms (hits " << stdHits << "/" << intrusiveHits << ")" << std::endl;
+}
+
+void integerSetExamples() {
+    std::cout << "\n--- Integer Sets ---" << std::endl;
+    RoaringSet unique_numbers;
+    unique_numbers.add(10);
+    unique_numbers.add(5);
+    unique_numbers.add(10);
+    std::cout << "Roaring set elements: ";
+    unique_numbers.forEach([](uint32_t n) { std::cout << n << " "; });
+    std::cout << std::endl;
+
+    // Benchmark: intersect and union two segment filters of ~1M ids each.
+    const uint32_t universe = 1u << 24;
+    const size_t n = 1000000;
+    std::mt19937 rng(5);
+    auto makeSegment = [&](uint32_t runStart) {
+        std::vector<uint32_t> ids;
+        for (size_t i = 0; i < n / 2; ++i) ids.push_back(rng() % universe);           // scattered ids
+        for (uint32_t i = 0; i < n / 2; ++i) ids.push_back(runStart + i);             // a dense id range
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    };
+    std::vector<uint32_t> a = makeSegment(1000000), b = makeSegment(1200000);
+
+    std::set<uint32_t> treeA(a.begin(), a.end()), treeB(b.begin(), b.end());
+    DynamicBitset bitsA(universe), bitsB(universe);
+    RoaringSet roarA, roarB;
+    for (uint32_t v : a) { bitsA.set(v); roarA.add(v); }
+    for (uint32_t v : b) { bitsB.set(v); roarB.add(v); }
+    roarA.runOptimize();
+    roarB.runOptimize();
+
+    size_t sizes[8] = {};
+    double treeAnd = benchmarkMs([&] {
+        std::vector<uint32_t> out;
+        std::set_intersection(treeA.begin(), treeA.end(), treeB.begin(), treeB.end(), std::back_inserter(out));
+        sizes[0] = out.size();
+    });
+    double vecAnd = benchmarkMs([&] {
+        std::vector<uint32_t> out;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+        sizes[1] = out.size();
+    });
+    double bitsAnd = benchmarkMs([&] {
+        DynamicBitset out = bitsA;
+        out &= bitsB;
+        sizes[2] = out.count();
+    });
+    double roarAnd = benchmarkMs([&] { sizes[3] = (roarA & roarB).cardinality(); });
+
+    double treeOr = benchmarkMs([&] {
+        std::set<uint32_t> out = treeA;
+        out.insert(treeB.begin(), treeB.end());
+        sizes[4] = out.size();
+    });
+    double vecOr = benchmarkMs([&] {
+        std::vector<uint32_t> out;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+        sizes[5] = out.size();
+    });
+    double bitsOr = benchmarkMs([&] {
+        DynamicBitset out = bitsA;
+        out |= bitsB;
+        sizes[6] = out.count();
+    });
+    double roarOr = benchmarkMs([&] { sizes[7] = (roarA | roarB).cardinality(); });
+
+    std::cout << a.size() << " and " << b.size() << " ids; roaring uses " << roarA.sizeInBytes() + roarB.sizeInBytes()
+              << " bytes, bitsets " << 2 * universe / 8 << " bytes" << std::endl;
+    std::cout << "intersection: std::set " << treeAnd << " ms, sorted vector " << vecAnd << " ms, bitset " << bitsAnd
+              << " ms, roaring " << roarAnd << " ms (sizes " << sizes[0] << "/" << sizes[1] << "/" << sizes[2] << "/" << sizes[3] << ")" << std::endl;
+    std::cout << "union:        std::set " << treeOr << " ms, sorted vector " << vecOr << " ms, bitset " << bitsOr
+              << " ms, roaring " << roarOr << " ms (sizes " << sizes[4] << "/" << sizes[5] << "/" << sizes[6] << "/" << sizes[7] << ")" << std::endl;
+}
+
 int main() {
     containerExamples();
     iteratorExamples();
     algorithmExamples();
+    flatContainerExamples();
+    hashMapExamples();
+    smallVectorExamples();
+    sortingExamples();
+    intrusiveListExamples();
+    integerSetExamples();
 
     return 0;
 }
\ No newline at end of file